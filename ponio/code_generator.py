@@ -425,7 +425,7 @@ def expRK_code_skeleton(X: list, c: list):
 
         if len(x.free_symbols) == 0:
             r['type'].append("value_t")
-            r['code'].append(x.evalf())
+            r['code'].append(f"static_cast<value_t>({x.evalf()})")
         else:
             r['type'].append("func_t")
             r['code'].append(
@@ -515,6 +515,15 @@ def sformat(value, fmt, attribute=None):
             yield (fmt.format(elm))
 
 
+def coefficients(value):
+    """
+      filter for Jinja2 to transform a list of coefficients into a list of explicit conversions to `value_t` (so a tableau in single
+      precision has no implicit narrowing conversion)
+    """
+    for elm in value:
+        yield f"static_cast<value_t>({elm})"
+
+
 parser = argparse.ArgumentParser(
     description="code generator of Runge-Kutta method from them Butcher tableau")
 parser.add_argument('FILE', nargs='*',
@@ -552,6 +561,7 @@ if __name__ == '__main__':
     print("total", total_meth)
 
     jinja2.filters.FILTERS['sformat'] = sformat
+    jinja2.filters.FILTERS['coefficients'] = coefficients
     local_dir = os.path.dirname(os.path.abspath(__file__))
     template_dir = os.path.join(local_dir, "template")
     env = jinja2.Environment(
@@ -73,9 +73,10 @@ main( int argc, char* argv[] )
     double const dt = 1e-3;
 
     auto brownian_pb = ponio::make_simple_problem(
-        [&]( double, state_t const& ) -> state_t
+        [&]( double, state_t const&, state_t& du )
         {
-            return { d( gen ), d( gen ) };
+            du[0] = d( gen );
+            du[1] = d( gen );
         } );
 
     state_t const yini = { 0., 0. };
@@ -60,9 +60,10 @@ main( int argc, char** argv )
     double const delta = 1.;
 
     auto lotka_volterra_pb = ponio::make_simple_problem( // define problem
-        [=]( double, state_t const& u ) -> state_t
+        [=]( double, state_t const& u, state_t& du )
         {
-            return { alpha * u[0] - beta * u[0] * u[1], delta * u[0] * u[1] - gamma * u[1] };
+            du[0] = alpha * u[0] - beta * u[0] * u[1];
+            du[1] = delta * u[0] * u[1] - gamma * u[1];
         } );
 
     ponio::time_span<double> const t_span = { 0., 15. }; // begin and end time
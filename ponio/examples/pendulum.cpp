@@ -47,11 +47,12 @@ main( int, char** )
     double const c = 5.0;
 
     auto pendulum_pb = ponio::make_simple_problem(
-        [=]( double, state_t const& y ) -> state_t
+        [=]( double, state_t const& y, state_t& dy )
         {
             double const theta = y[0];
             double const omega = y[1];
-            return { omega, -b * omega - c * std::sin( theta ) };
+            dy[0]              = omega;
+            dy[1]              = -b * omega - c * std::sin( theta );
         } );
 
     state_t const yini = { std::numbers::pi - 0.1, 0. };
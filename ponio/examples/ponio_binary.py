@@ -0,0 +1,80 @@
+# Copyright 2022 PONIO TEAM. All rights reserved.
+# Use of this source code is governed by a BSD-style
+# license that can be found in the LICENSE file.
+
+#!/usr/bin/env python
+
+"""
+Reader of files written by `ponio::observer::binary_observer`.
+
+The file starts with a header: magic string `PONIOCOL` (8 bytes), NumPy
+dtype of values with byte order (4 bytes, padded with `\\0`) and version
+(unsigned integer of 4 bytes). It is followed by blocks: number of records
+`n` and number of columns `m` (unsigned integers of 8 bytes), then `m`
+columns of `n` values: `t`, `dt` and each component of `u`.
+"""
+
+import argparse
+
+import numpy as np
+
+MAGIC = b"PONIOCOL"
+
+
+def read(filename):
+    """
+    Read a binary file written by `ponio::observer::binary_observer`.
+
+    Returns `(t, dt, u)`: `t` and `dt` are 1D arrays, `u` is a 2D array (one
+    row per record) if size of state does not change, otherwise a list of 1D
+    arrays. An incomplete last block (interrupted run) is ignored.
+    """
+    with open(filename, "rb") as f:
+        raw = f.read()
+
+    if raw[:8] != MAGIC:
+        raise ValueError(f"{filename} is not a ponio binary file")
+
+    dtype = np.dtype(raw[8:12].rstrip(b"\0").decode())
+    size_t = np.dtype(dtype.byteorder + "u8")
+    version = int(np.frombuffer(raw, dtype=dtype.byteorder + "u4", count=1, offset=12)[0])
+    if version != 1:
+        raise ValueError(f"unsupported version {version} of ponio binary file")
+
+    t, dt, u = [], [], []
+    offset = 16
+    while offset + 2 * size_t.itemsize <= len(raw):
+        n, m = (int(x) for x in np.frombuffer(raw, dtype=size_t, count=2, offset=offset))
+        offset += 2 * size_t.itemsize
+        if offset + n * m * dtype.itemsize > len(raw):
+            break
+
+        columns = np.frombuffer(raw, dtype=dtype, count=n * m, offset=offset).reshape(m, n)
+        offset += n * m * dtype.itemsize
+
+        t.append(columns[0])
+        dt.append(columns[1])
+        u.append(columns[2:].T)
+
+    t = np.concatenate(t) if t else np.empty(0, dtype=dtype)
+    dt = np.concatenate(dt) if dt else np.empty(0, dtype=dtype)
+    if len({block.shape[1] for block in u}) <= 1:
+        u = np.concatenate(u) if u else np.empty((0, 0), dtype=dtype)
+    else:
+        u = [row for block in u for row in block]
+
+    return t, dt, u
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Convert a ponio binary file into the text format of `ponio::observer::file_observer` (`t u dt` on each line)")
+    parser.add_argument("input", help="binary file written by `ponio::observer::binary_observer`")
+    parser.add_argument("output", help="output text file")
+
+    arguments = parser.parse_args()
+
+    t, dt, u = read(arguments.input)
+    with open(arguments.output, "w") as f:
+        for tn, dtn, un in zip(t, dt, u):
+            f.write(" ".join(repr(float(x)) for x in (tn, *un, dtn)) + "\n")
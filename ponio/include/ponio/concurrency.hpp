@@ -0,0 +1,386 @@
+// Copyright 2022 PONIO TEAM. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <any>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ponio::detail
+{
+
+    /** @class worker_pool
+     *  pool of persistent threads which share the tasks of a parallel loop with the calling thread
+     *  @details Threads are created once by the constructor and wait for a loop between two calls, so a loop does not pay the creation
+     *  of threads. Tasks of a loop are claimed one by one through an atomic counter, by workers and by the calling thread. Only one loop
+     *  runs at a time on the pool: a loop submitted while the pool is busy (from another thread, or from a task of the running loop) is
+     *  executed on the calling thread, so nested or concurrent calls never wait on each other.
+     */
+    class worker_pool
+    {
+      public:
+
+        explicit worker_pool( std::size_t n_workers );
+
+        worker_pool( worker_pool const& )            = delete;
+        worker_pool( worker_pool&& )                 = delete;
+        worker_pool& operator=( worker_pool const& ) = delete;
+        worker_pool& operator=( worker_pool&& )      = delete;
+
+        ~worker_pool();
+
+        std::size_t
+        size() const;
+
+        template <typename Function_t>
+        void
+        parallel_for( std::size_t n, Function_t&& f );
+
+      private:
+
+        /**
+         * loop submitted to workers, it lives on the stack of the calling thread
+         */
+        struct job
+        {
+            void ( *invoke )( void*, std::size_t );
+            void* context;
+            std::size_t n;
+            std::atomic<std::size_t> next{ 0 };
+            std::atomic<std::size_t> n_done{ 0 };
+            std::mutex error_mutex;
+            std::exception_ptr error;
+        };
+
+        std::vector<std::thread> _workers;
+        std::mutex _submit_mutex; /**< owned by the thread which submits a loop */
+        std::mutex _mutex;
+        std::condition_variable _start;
+        std::condition_variable _done;
+        job* _job               = nullptr;
+        std::size_t _generation = 0;
+        std::size_t _active     = 0; /**< number of workers which work on `_job` */
+        bool _stop              = false;
+
+        static void
+        _run( job& current );
+
+        void
+        _work_loop();
+    };
+
+    /**
+     * constructor of \ref worker_pool
+     * @param n_workers number of threads created (the calling thread of a loop works with them)
+     */
+    inline worker_pool::worker_pool( std::size_t n_workers )
+    {
+        _workers.reserve( n_workers );
+        for ( std::size_t i = 0; i < n_workers; ++i )
+        {
+            _workers.emplace_back(
+                [this]()
+                {
+                    _work_loop();
+                } );
+        }
+    }
+
+    /**
+     * destructor of \ref worker_pool, stops and joins all threads
+     */
+    inline worker_pool::~worker_pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock( _mutex );
+            _stop = true;
+        }
+        _start.notify_all();
+        for ( auto& worker : _workers )
+        {
+            worker.join();
+        }
+    }
+
+    /**
+     * number of threads of pool (without the calling thread)
+     */
+    inline std::size_t
+    worker_pool::size() const
+    {
+        return _workers.size();
+    }
+
+    /**
+     * calls `f(i)` for each \f$i\in [0, n)\f$, and returns when all calls are done
+     *
+     * @param n number of tasks
+     * @param f task to call with its index
+     *
+     * @details the first exception thrown by a task is rethrown once all tasks are done.
+     */
+    template <typename Function_t>
+    inline void
+    worker_pool::parallel_for( std::size_t n, Function_t&& f )
+    {
+        std::unique_lock<std::mutex> submit_lock( _submit_mutex, std::try_to_lock );
+        if ( !submit_lock.owns_lock() || _workers.empty() || n < 2 )
+        {
+            for ( std::size_t i = 0; i < n; ++i )
+            {
+                f( i );
+            }
+            return;
+        }
+
+        job current;
+        current.invoke = []( void* context, std::size_t i )
+        {
+            ( *static_cast<std::remove_reference_t<Function_t>*>( context ) )( i );
+        };
+        current.context = static_cast<void*>( std::addressof( f ) );
+        current.n       = n;
+
+        {
+            std::lock_guard<std::mutex> lock( _mutex );
+            _job = &current;
+            ++_generation;
+        }
+        _start.notify_all();
+
+        _run( current );
+
+        {
+            std::unique_lock<std::mutex> lock( _mutex );
+            _done.wait( lock,
+                [&]()
+                {
+                    return _active == 0 && current.n_done.load( std::memory_order_acquire ) == n;
+                } );
+            _job = nullptr;
+        }
+
+        if ( current.error )
+        {
+            std::rethrow_exception( current.error );
+        }
+    }
+
+    /**
+     * claims and calls tasks of a loop until all of them are claimed
+     *
+     * @param current loop to work on
+     */
+    inline void
+    worker_pool::_run( job& current )
+    {
+        for ( std::size_t i = current.next.fetch_add( 1, std::memory_order_relaxed ); i < current.n;
+              i             = current.next.fetch_add( 1, std::memory_order_relaxed ) )
+        {
+            try
+            {
+                current.invoke( current.context, i );
+            }
+            catch ( ... )
+            {
+                std::lock_guard<std::mutex> lock( current.error_mutex );
+                if ( !current.error )
+                {
+                    current.error = std::current_exception();
+                }
+            }
+            current.n_done.fetch_add( 1, std::memory_order_release );
+        }
+    }
+
+    /**
+     * loop of each thread: waits for a new loop and works on it
+     */
+    inline void
+    worker_pool::_work_loop()
+    {
+        std::size_t seen_generation = 0;
+
+        std::unique_lock<std::mutex> lock( _mutex );
+        while ( true )
+        {
+            _start.wait( lock,
+                [&]()
+                {
+                    return _stop || ( _job != nullptr && _generation != seen_generation );
+                } );
+            if ( _stop )
+            {
+                return;
+            }
+
+            seen_generation = _generation;
+            job* current    = _job;
+            ++_active;
+            lock.unlock();
+
+            _run( *current );
+
+            lock.lock();
+            --_active;
+            if ( _active == 0 )
+            {
+                _done.notify_all();
+            }
+        }
+    }
+
+    /** @class buffer_pool
+     *  thread-safe set of preallocated objects, each one is lent to a single thread at a time
+     *  @details objects are created by a factory when all of them are lent, and kept for next calls, so the pool allocates as many objects
+     *  as the maximal number of concurrent users. Type of objects is erased: if it changes, objects of previous type are released.
+     */
+    class buffer_pool
+    {
+      public:
+
+        /** @class lease
+         *  object lent by a \ref buffer_pool, it is given back to the pool on destruction
+         */
+        template <typename T>
+        class lease
+        {
+          public:
+
+            lease( buffer_pool& pool, std::unique_ptr<T> ptr )
+                : _pool( pool )
+                , _ptr( std::move( ptr ) )
+            {
+            }
+
+            lease( lease const& )            = delete;
+            lease( lease&& )                 = delete;
+            lease& operator=( lease const& ) = delete;
+            lease& operator=( lease&& )      = delete;
+
+            ~lease()
+            {
+                _pool.release( std::move( _ptr ) );
+            }
+
+            T&
+            operator*() const
+            {
+                return *_ptr;
+            }
+
+          private:
+
+            buffer_pool& _pool;
+            std::unique_ptr<T> _ptr;
+        };
+
+        template <typename T, typename Factory_t>
+        std::unique_ptr<T>
+        acquire( Factory_t&& make );
+
+        template <typename T>
+        void
+        release( std::unique_ptr<T> ptr );
+
+        template <typename T, typename Factory_t>
+        void
+        reserve( std::size_t n, Factory_t&& make );
+
+      private:
+
+        template <typename T>
+        using free_list_t = std::vector<std::unique_ptr<T>>;
+
+        std::mutex _mutex;
+        std::any _free; /**< `std::shared_ptr<free_list_t<T>>` of available objects (`std::any` needs a copyable type) */
+
+        template <typename T>
+        free_list_t<T>&
+        _free_list();
+    };
+
+    /**
+     * takes an available object, or builds a new one with `make()` if all of them are lent
+     *
+     * @tparam T type of object
+     * @param make factory which returns a `T`
+     */
+    template <typename T, typename Factory_t>
+    inline std::unique_ptr<T>
+    buffer_pool::acquire( Factory_t&& make )
+    {
+        {
+            std::lock_guard<std::mutex> lock( _mutex );
+            auto& free = _free_list<T>();
+            if ( !free.empty() )
+            {
+                auto ptr = std::move( free.back() );
+                free.pop_back();
+                return ptr;
+            }
+        }
+        return std::make_unique<T>( make() );
+    }
+
+    /**
+     * gives back an object to the pool
+     *
+     * @tparam T type of object
+     * @param ptr object to give back
+     */
+    template <typename T>
+    inline void
+    buffer_pool::release( std::unique_ptr<T> ptr )
+    {
+        std::lock_guard<std::mutex> lock( _mutex );
+        _free_list<T>().push_back( std::move( ptr ) );
+    }
+
+    /**
+     * builds objects until at least `n` of them are available
+     *
+     * @tparam T type of object
+     * @param n    number of available objects
+     * @param make factory which returns a `T`
+     */
+    template <typename T, typename Factory_t>
+    inline void
+    buffer_pool::reserve( std::size_t n, Factory_t&& make )
+    {
+        std::lock_guard<std::mutex> lock( _mutex );
+        auto& free = _free_list<T>();
+        while ( free.size() < n )
+        {
+            free.push_back( std::make_unique<T>( make() ) );
+        }
+    }
+
+    /**
+     * gets list of available objects of type `T`, objects of another type are released (must be called under lock)
+     *
+     * @tparam T type of object
+     */
+    template <typename T>
+    inline buffer_pool::free_list_t<T>&
+    buffer_pool::_free_list()
+    {
+        auto* free = std::any_cast<std::shared_ptr<free_list_t<T>>>( &_free );
+        if ( free == nullptr )
+        {
+            free = &_free.emplace<std::shared_ptr<free_list_t<T>>>( std::make_shared<free_list_t<T>>() );
+        }
+        return **free;
+    }
+
+} // namespace ponio::detail
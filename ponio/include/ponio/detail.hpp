@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array> // NOLINT(misc-include-cleaner)
 #include <cmath>
 #include <concepts>
@@ -15,6 +16,7 @@
 #include <utility>
 
 #include "expressions/state.hpp"
+#include "reduction.hpp"
 
 namespace ponio::detail
 {
@@ -51,7 +53,7 @@ namespace ponio::detail
             } );
 
         using namespace std;
-        return sqrt( accu );
+        return sqrt( reduce_sum( x, accu ) );
     }
 
 #ifndef IN_DOXYGEN
@@ -97,7 +99,11 @@ namespace ponio::detail
             r += tmp * tmp;
         }
 
-        return sqrt( ( 1. / static_cast<double>( n_elm ) ) * r );
+        // sums over all processes (see @ref ponio::global_reduction)
+        r          = reduce_sum( un, r );
+        auto n_all = reduce_sum( un, static_cast<value_t>( n_elm ) );
+
+        return sqrt( ( 1. / static_cast<double>( n_all ) ) * r );
 
         /*
         return std::sqrt(
@@ -113,11 +119,40 @@ namespace ponio::detail
         */
     }
 
+    /**
+     * @brief concept to use operators of `state_t` in @ref tpl_inner_product, otherwise ponio expressions are used (see @ref
+     * ponio::expression::use_expression)
+     */
     template <typename state_t, typename value_t, typename ArrayA_t, typename ArrayB_t>
-    concept tpl_inner_product_requirement = requires( ArrayA_t a, ArrayB_t b, state_t init, value_t mul_coeff, state_t output ) {
+    concept tpl_inner_product_requirement = !expression::use_expression_v<state_t>
+                                         && requires( ArrayA_t a, ArrayB_t b, state_t init, value_t mul_coeff, state_t output ) {
                                                 output = init + mul_coeff * a[0] * b[0];
                                             };
 
+    /**
+     * @brief pairwise sum of terms \f$\texttt{term}(a_i, b_i)\f$ for \f$i\in[I, I+N)\f$: sum of each half is computed first, so the
+     * rounding error grows as \f$\log_2 N\f$ instead of \f$N\f$
+     *
+     * @tparam I first index
+     * @tparam N number of terms (at least 1)
+     * @param a    first array
+     * @param b    second array
+     * @param term function which computes a term from \f$a_i\f$ and \f$b_i\f$
+     */
+    template <std::size_t I, std::size_t N, typename ArrayA_t, typename ArrayB_t, typename term_t>
+    constexpr auto
+    pairwise_sum( ArrayA_t const& a, ArrayB_t const& b, term_t const& term )
+    {
+        if constexpr ( N == 1 )
+        {
+            return term( a[I], b[I] );
+        }
+        else
+        {
+            return pairwise_sum<I, N / 2>( a, b, term ) + pairwise_sum<I + N / 2, N - N / 2>( a, b, term );
+        }
+    }
+
     /* tpl_inner_product */
     template <typename state_t, typename value_t, typename ArrayA_t, typename ArrayB_t, std::size_t... Is>
         requires tpl_inner_product_requirement<state_t, value_t, ArrayA_t, ArrayB_t>
@@ -129,9 +164,57 @@ namespace ponio::detail
         state_t& output,
         std::index_sequence<Is...> )
     {
+#if defined( PONIO_USE_COMPENSATED_SUM )
+        if constexpr ( sizeof...( Is ) > 0 )
+        {
+            output = init
+                   + mul_coeff
+                         * pairwise_sum<0, sizeof...( Is )>( a,
+                             b,
+                             []( auto const& ai, auto const& bi )
+                             {
+                                 return ai * bi;
+                             } );
+            return;
+        }
+#endif
         output = ( init + ... + ( mul_coeff * ( a[Is] * b[Is] ) ) );
     }
 
+    /**
+     * @brief expression of \f$\texttt{init} + \sum_{i=0}^N \texttt{mul_coeff}a_ib_i\f$ (stages are summed pairwise if ponio is compiled
+     * with `PONIO_USE_COMPENSATED_SUM`)
+     */
+    template <typename state_t, typename value_t, typename ArrayA_t, typename ArrayB_t, std::size_t... Is>
+    constexpr auto
+    tpl_inner_product_expression( ArrayA_t const& a,
+        ArrayB_t const& b,
+        state_t const& init,
+        [[maybe_unused]] value_t const& mul_coeff,
+        std::index_sequence<Is...> )
+    {
+#if defined( PONIO_USE_COMPENSATED_SUM )
+        if constexpr ( sizeof...( Is ) > 0 )
+        {
+            return expression::make_state( init )
+                 + expression::make_scalar( mul_coeff )
+                       * pairwise_sum<0, sizeof...( Is )>( a,
+                           b,
+                           []( auto const& ai, auto const& bi )
+                           {
+                               return expression::make_scalar( ai ) * expression::make_state( bi );
+                           } );
+        }
+        else
+        {
+            return expression::make_state( init );
+        }
+#else
+        return ( expression::make_state( init ) + ...
+                 + ( expression::make_scalar( mul_coeff ) * ( expression::make_scalar( a[Is] ) * expression::make_state( b[Is] ) ) ) );
+#endif
+    }
+
     template <typename state_t, typename value_t, typename ArrayA_t, typename ArrayB_t, std::size_t... Is>
     constexpr void
     tpl_inner_product_impl( ArrayA_t const& a,
@@ -141,11 +224,21 @@ namespace ponio::detail
         state_t& output,
         std::index_sequence<Is...> )
     {
-        expression::make_state( output ) = ( expression::make_state( init ) + ...
-                                             + ( expression::make_scalar( mul_coeff )
-                                                 * ( expression::make_scalar( a[Is] ) * expression::make_state( b[Is] ) ) ) );
+        expression::make_state( output ) = tpl_inner_product_expression( a, b, init, mul_coeff, std::index_sequence<Is...>() );
     }
 
+    /**
+     * @brief customization point to compute linear combinations of @ref tpl_inner_product with a library of a state type, a
+     * specialization defines `template <std::size_t N> static void compute( a, b, init, mul_coeff, output )` (see for example
+     * `expressions/petsc.hpp`)
+     *
+     * @tparam state_t type of state
+     */
+    template <typename state_t>
+    struct inner_product_kernel
+    {
+    };
+
     /**
      * @brief inner product between two array from 0 to N
      *
@@ -161,15 +254,175 @@ namespace ponio::detail
      * @param mul_coeff coefficient to multiply each multiplication of inner product
      * @param output    output to store result
      *
-     * @details This function compute \f$\texttt{init} + \sum_{i=0}^N \texttt{mul_coeff}a_ib_i\f$ without loop thanks to template.
+     * @details This function compute \f$\texttt{init} + \sum_{i=0}^N \texttt{mul_coeff}a_ib_i\f$ without loop thanks to template. If
+     * @ref inner_product_kernel is specialized for `state_t`, it computes the linear combination instead.
      */
     template <std::size_t N, typename state_t, typename value_t, typename ArrayA_t, typename ArrayB_t>
     constexpr void
     tpl_inner_product( ArrayA_t const& a, ArrayB_t const& b, state_t const& init, value_t const& mul_coeff, state_t& output )
     {
-        tpl_inner_product_impl( a, b, init, mul_coeff, output, std::make_index_sequence<N>() );
+        if constexpr ( requires { inner_product_kernel<state_t>::template compute<N>( a, b, init, mul_coeff, output ); } )
+        {
+            inner_product_kernel<state_t>::template compute<N>( a, b, init, mul_coeff, output );
+        }
+        else
+        {
+            tpl_inner_product_impl( a, b, init, mul_coeff, output, std::make_index_sequence<N>() );
+        }
+    }
+
+    /**
+     * @brief reduction `reduction_t` which returns its accumulation without finalizing it (so it could be reduced over processes first)
+     *
+     * @tparam reduction_t type of reduction
+     */
+    template <typename reduction_t>
+    struct unfinalized_reduction : reduction_t
+    {
+        typename reduction_t::value_type
+        finalize( typename reduction_t::value_type acc, std::size_t ) const
+        {
+            return acc;
+        }
+    };
+
+    /**
+     * @brief concept to test if the error estimate of a state could be computed with the last stage of an embedded method in a single
+     * pass (see @ref tpl_inner_product_and_error)
+     *
+     * @tparam state_t type of state
+     */
+    template <typename state_t>
+    concept has_fused_error_estimate = std::ranges::random_access_range<state_t> && std::ranges::sized_range<state_t>
+                                    && std::is_arithmetic_v<std::ranges::range_value_t<state_t>>;
+
+    /**
+     * @brief inner product between two array from 0 to N (as @ref tpl_inner_product) and error estimate between `output` and `unp1`
+     * computed in the same loop
+     *
+     * @tparam N        number of elements to compute
+     * @param a         first array
+     * @param b         second array
+     * @param init      starting value to add other values to (\f$u^n\f$)
+     * @param mul_coeff coefficient to multiply each multiplication of inner product
+     * @param output    output to store result (\f$\tilde{u}^{n+1}\f$)
+     * @param unp1      state \f$u^{n+1}\f$
+     * @param a_tol     absolute tolerance
+     * @param r_tol     relative tolerance
+     * @return error estimate \f$\sqrt{\frac{1}{N}\sum_i \left( \frac{|u^{n+1}_i - \tilde{u}^{n+1}_i|}{a_{tol}+ r_{tol} \max(|u^n_i|,
+     * |u^{n+1}_i|)}\right)^2}\f$, as @ref error_estimate
+     */
+    template <std::size_t N, typename state_t, typename value_t, typename ArrayA_t, typename ArrayB_t>
+        requires has_fused_error_estimate<state_t>
+    auto
+    tpl_inner_product_and_error( ArrayA_t const& a,
+        ArrayB_t const& b,
+        state_t const& init,
+        value_t const& mul_coeff,
+        state_t& output,
+        state_t const& unp1,
+        value_t a_tol,
+        value_t r_tol )
+    {
+        using namespace expression;
+
+        auto red = weighted_rms( make_state( unp1 ) - make_state( output ),
+            make_scalar( a_tol ) + make_scalar( r_tol ) * expression::max( abs( make_state( init ) ), abs( make_state( unp1 ) ) ) );
+
+        // local sum of squares is reduced over all processes before the root mean square (see @ref ponio::global_reduction)
+        auto acc = make_state( output ).assign_and_reduce(
+            tpl_inner_product_expression( a, b, init, mul_coeff, std::make_index_sequence<N>() ),
+            unfinalized_reduction<decltype( red )>{ red } );
+        auto n = static_cast<decltype( acc )>( std::ranges::size( init ) );
+
+        using std::sqrt;
+        return sqrt( reduce_sum( init, acc ) / reduce_sum( init, n ) );
+    }
+
+    /**
+     * @brief adds `x` to `y` in place if `state_t` provides `operator+=`, otherwise computes \f$y = y + x\f$
+     *
+     * @param y value to update
+     * @param x value to add
+     */
+    template <typename state_t>
+    constexpr void
+    add_in_place( state_t& y, state_t const& x )
+    {
+        if constexpr ( requires { y += x; } )
+        {
+            y += x;
+        }
+        else
+        {
+            y = y + x;
+        }
+    }
+
+    /**
+     * @brief clamps time step proposed by an adaptive method: its magnitude stays in \f$[0.2|\Delta t|, 5|\Delta t|]\f$ and its sign is the
+     * sign of \f$\Delta t\f$
+     *
+     * @param new_dt proposed time step
+     * @param dt     current time step
+     *
+     * @details a negative time step (a sub-problem of a composition method solved backward in time) gives a negative proposed time step,
+     * so bounds are applied on magnitudes.
+     */
+    template <typename value_t>
+    value_t
+    clamp_time_step( value_t new_dt, value_t dt )
+    {
+        value_t const abs_dt = std::abs( dt );
+        return std::copysign( std::clamp( std::abs( new_dt ), static_cast<value_t>( 0.2 ) * abs_dt, static_cast<value_t>( 5. ) * abs_dt ),
+            dt );
     }
 
+    /**
+     * @brief compensated (Kahan) summation: the rounding error of each addition is stored and added back to the next one, so the error of
+     * the sum of \f$n\f$ values doesn't grow with \f$n\f$
+     *
+     * @tparam value_t type of summed values
+     *
+     * @warning compensation is removed by optimizations which reorder floating point operations (like `-ffast-math`)
+     */
+    template <typename value_t>
+    struct compensated_sum
+    {
+        value_t sum          = static_cast<value_t>( 0 ); /**< current sum */
+        value_t compensation = static_cast<value_t>( 0 ); /**< rounding error of the last addition */
+
+        /**
+         * @brief restarts sum from a value
+         *
+         * @param value new value of sum
+         * @return new value of sum
+         */
+        value_t
+        reset( value_t value )
+        {
+            sum          = value;
+            compensation = static_cast<value_t>( 0 );
+            return sum;
+        }
+
+        /**
+         * @brief adds a value to the sum
+         *
+         * @param x value to add
+         * @return new value of sum
+         */
+        value_t
+        add( value_t x )
+        {
+            value_t const y = x - compensation;
+            value_t const t = sum + y;
+            compensation    = ( t - sum ) - y;
+            sum             = t;
+            return sum;
+        }
+    };
+
     /* init_fill_array */
     // first version with a value
     template <typename T, std::size_t... Is>
@@ -206,6 +459,154 @@ namespace ponio::detail
         return init_fill_array_impl( std::forward<T>( value ), std::make_index_sequence<N>() );
     }
 
+    /* mixed_precision_storage */
+    /**
+     * @brief storage of a step of a method whose stages \f$k_i\f$ are stored in a container `stage_state_t` (for example in reduced
+     * precision), while solutions computed from stages (\f$u^{n+1}\f$ and \f$\tilde{u}^{n+1}\f$) are stored in `state_t`
+     *
+     * @tparam stage_state_t type of stages
+     * @tparam state_t       type of state
+     * @tparam N_stages      number of stages
+     * @tparam N_solutions   number of solutions
+     *
+     * @details `operator[]` gives access to stages only, so this storage could be given to @ref tpl_inner_product as an array of stages,
+     * the I-th element of the step (stage or solution) is given by @ref stage_at.
+     */
+    template <typename stage_state_t, typename state_t, std::size_t N_stages, std::size_t N_solutions>
+    struct mixed_precision_storage
+    {
+        using stage_state_type = stage_state_t;
+        using state_type       = state_t;
+
+        std::array<stage_state_t, N_stages> stages;
+        std::array<state_t, N_solutions> solutions;
+
+        /**
+         * @brief builds storage from a shadow of state (see @ref make_stage)
+         *
+         * @param shadow_of_u0 an object with the same size of computed value for allocation
+         */
+        mixed_precision_storage( state_t const& shadow_of_u0 )
+            : stages( init_fill_array<N_stages>( static_cast<stage_state_t const&>( make_stage( shadow_of_u0 ) ) ) )
+            , solutions( init_fill_array<N_solutions>( shadow_of_u0 ) )
+        {
+        }
+
+        mixed_precision_storage() = default;
+
+        /**
+         * @brief builds a stage from a state: from its range of values for a container, by a conversion otherwise
+         *
+         * @param u state
+         */
+        static stage_state_t
+        make_stage( state_t const& u )
+        {
+            if constexpr ( std::ranges::range<state_t> )
+            {
+                return stage_state_t( std::ranges::begin( u ), std::ranges::end( u ) );
+            }
+            else
+            {
+                return static_cast<stage_state_t>( u );
+            }
+        }
+
+        auto&
+        operator[]( std::size_t i )
+        {
+            return stages[i];
+        }
+
+        auto const&
+        operator[]( std::size_t i ) const
+        {
+            return stages[i];
+        }
+    };
+
+    /**
+     * @brief type of stages of an algorithm for a state of type `state_t`: `Algorithm_t::stage_state<state_t>` if it is defined,
+     * `state_t` otherwise
+     *
+     * @tparam Algorithm_t type of algorithm
+     * @tparam state_t     type of state
+     */
+    template <typename Algorithm_t, typename state_t>
+    struct stage_state
+    {
+        using type = state_t;
+    };
+
+    template <typename Algorithm_t, typename state_t>
+        requires requires { typename Algorithm_t::template stage_state<state_t>; }
+    struct stage_state<Algorithm_t, state_t>
+    {
+        using type = typename Algorithm_t::template stage_state<state_t>;
+    };
+
+    template <typename T>
+    struct is_mixed_precision_storage : std::false_type
+    {
+    };
+
+    template <typename stage_state_t, typename state_t, std::size_t N_stages, std::size_t N_solutions>
+    struct is_mixed_precision_storage<mixed_precision_storage<stage_state_t, state_t, N_stages, N_solutions>> : std::true_type
+    {
+    };
+
+    /**
+     * @brief gets the I-th element of storage of a step: stage \f$k_I\f$ or, after stages, a solution
+     *
+     * @tparam I index of element
+     * @param storage storage of a step (`std::array` or @ref mixed_precision_storage)
+     */
+    template <std::size_t I, typename storage_t>
+    constexpr auto&
+    stage_at( storage_t& storage )
+    {
+        if constexpr ( is_mixed_precision_storage<std::remove_const_t<storage_t>>::value )
+        {
+            constexpr std::size_t N_stages = std::tuple_size_v<decltype( storage.stages )>;
+            if constexpr ( I < N_stages )
+            {
+                return std::get<I>( storage.stages );
+            }
+            else
+            {
+                return std::get<I - N_stages>( storage.solutions );
+            }
+        }
+        else
+        {
+            return std::get<I>( storage );
+        }
+    }
+
+    /**
+     * @brief calls `f` on each element of storage of a step (stages and solutions)
+     *
+     * @param storage storage of a step (range or @ref mixed_precision_storage)
+     * @param f       function to call
+     */
+    template <typename storage_t, typename function_t>
+    constexpr void
+    for_each_stage( storage_t& storage, function_t&& f ) // NOLINT(cppcoreguidelines-missing-std-forward)
+    {
+        if constexpr ( is_mixed_precision_storage<std::remove_const_t<storage_t>>::value )
+        {
+            for_each_stage( storage.stages, f );
+            for_each_stage( storage.solutions, f );
+        }
+        else
+        {
+            for ( auto& ki : storage )
+            {
+                f( ki );
+            }
+        }
+    }
+
     /* applyable_impl */
     // unpack tuple to test if `function_t` is invocable with types in tuple
     template <typename function_t, typename tuple_args_t, std::size_t... Is>
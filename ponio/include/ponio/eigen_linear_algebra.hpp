@@ -18,6 +18,10 @@
 
 // NOLINTEND(misc-include-cleaner)
 
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
 #include "linear_algebra.hpp"
 
 namespace ponio::linear_algebra
@@ -92,3 +96,251 @@ namespace ponio::linear_algebra
     };
 
 } // namespace ponio::linear_algebra
+
+namespace ponio::shampine_trick
+{
+
+    /**
+     * @brief For PIROCK method, compute the Shampine's trick on Eigen dense states
+     *
+     * @tparam scalar_t type of coefficients
+     * @tparam rows     number of unknowns (could be `Eigen::Dynamic`)
+     *
+     * @details the LU factorization of \f$I - \alpha J_R\f$ is kept between two calls, it is only computed again when \f$\alpha =
+     * \gamma\Delta t\f$ or the Jacobian \f$J_R\f$ changes. This specialization could be built from the type of state or from the type
+     * of the Jacobian.
+     */
+    template <typename scalar_t, int rows, int cols, int options, int maxrows, int maxcols>
+    struct shampine_trick<Eigen::Matrix<scalar_t, rows, cols, options, maxrows, maxcols>> // NOLINT(misc-include-cleaner)
+    {
+        using matrix_type = Eigen::Matrix<scalar_t, rows, rows>; // NOLINT(misc-include-cleaner)
+        using solver_type = Eigen::PartialPivLU<matrix_type>;    // NOLINT(misc-include-cleaner)
+
+        matrix_type J_cached;
+        solver_type solver;
+        scalar_t alpha_J_cached = static_cast<scalar_t>( 0. );
+        bool is_factorized      = false;
+
+        shampine_trick() = default;
+
+        // a copy factorizes its own matrix on first call (without reading an uninitialized factorization)
+        shampine_trick( shampine_trick const& )
+            : shampine_trick()
+        {
+        }
+
+        shampine_trick( shampine_trick&& )
+            : shampine_trick()
+        {
+        }
+
+        shampine_trick&
+        operator=( shampine_trick const& )
+        {
+            reset();
+            return *this;
+        }
+
+        shampine_trick&
+        operator=( shampine_trick&& )
+        {
+            reset();
+            return *this;
+        }
+
+        ~shampine_trick() = default;
+
+        /**
+         * @brief forces a new factorization at next call
+         */
+        void
+        reset()
+        {
+            is_factorized = false;
+        }
+
+        /**
+         * @brief checks if stored factorization is still valid for a given \f$\alpha\f$ and a Jacobian
+         *
+         * @param alpha \f$\alpha = \gamma\Delta t\f$
+         * @param J     Jacobian \f$J_R\f$ of reaction operator
+         */
+        template <typename jacobian_t>
+        bool
+        is_assembled( scalar_t alpha, jacobian_t const& J ) const
+        {
+            return is_factorized && alpha == alpha_J_cached && J.rows() == J_cached.rows() && J.cols() == J_cached.cols() && J == J_cached;
+        }
+
+        /**
+         * @brief solves \f$(I - \alpha J_R)^{\ell}X = b\f$
+         *
+         * @tparam ell
+         * @tparam jacobian_t type of Jacobian
+         * @tparam state_t    type of state
+         * @param alpha           in Shampine's trick \f$\alpha = \gamma \Delta t\f$
+         * @param J               Jacobian \f$J_R\f$ of reaction operator
+         * @param rhs             right hand side term, \f$b\f$
+         * @param u_tmp           temporary variable
+         * @param shampine_result result of unknown \f$X\f$
+         */
+        template <std::size_t ell, typename jacobian_t, typename state_t>
+        void
+        operator()( scalar_t alpha, jacobian_t const& J, state_t&, state_t& rhs, state_t& u_tmp, state_t& shampine_result )
+        {
+            if ( !is_assembled( alpha, J ) )
+            {
+                J_cached = J;
+                solver.compute( matrix_type::Identity( J.rows(), J.cols() ) - alpha * J_cached );
+
+                alpha_J_cached = alpha;
+                is_factorized  = true;
+            }
+
+            if constexpr ( ell == 2 )
+            {
+                u_tmp           = solver.solve( rhs );
+                shampine_result = solver.solve( u_tmp );
+            }
+            else
+            {
+                shampine_result = solver.solve( rhs );
+            }
+        }
+    };
+
+    /**
+     * @brief For PIROCK method, compute the Shampine's trick with an Eigen sparse Jacobian
+     *
+     * @tparam scalar_t type of coefficients
+     *
+     * @details the sparse LU factorization of \f$I - \alpha J_R\f$ is kept between two calls, it is only computed again when \f$\alpha
+     * = \gamma\Delta t\f$ or the Jacobian \f$J_R\f$ changes, and the symbolic analysis is only done again if the sparsity pattern of
+     * \f$J_R\f$ changes.
+     */
+    template <typename scalar_t>
+    struct shampine_trick<Eigen::SparseMatrix<scalar_t>> // NOLINT(misc-include-cleaner)
+    {
+        using matrix_type   = Eigen::SparseMatrix<scalar_t>;                                  // NOLINT(misc-include-cleaner)
+        using ordering_type = Eigen::COLAMDOrdering<typename matrix_type::StorageIndex>;      // NOLINT(misc-include-cleaner)
+        using solver_type   = Eigen::SparseLU<matrix_type, ordering_type>;                    // NOLINT(misc-include-cleaner)
+
+        matrix_type J_cached;
+        matrix_type I_alpha_J;
+        solver_type solver;
+        scalar_t alpha_J_cached = static_cast<scalar_t>( 0. );
+        bool is_analyzed        = false;
+        bool is_factorized      = false;
+
+        shampine_trick() = default;
+
+        // a sparse LU factorization could not be copied, a copy analyzes and factorizes its own matrix on first call
+        shampine_trick( shampine_trick const& )
+            : shampine_trick()
+        {
+        }
+
+        shampine_trick( shampine_trick&& )
+            : shampine_trick()
+        {
+        }
+
+        shampine_trick&
+        operator=( shampine_trick const& )
+        {
+            reset();
+            return *this;
+        }
+
+        shampine_trick&
+        operator=( shampine_trick&& )
+        {
+            reset();
+            return *this;
+        }
+
+        ~shampine_trick() = default;
+
+        /**
+         * @brief forces a new symbolic analysis and factorization at next call
+         */
+        void
+        reset()
+        {
+            is_analyzed   = false;
+            is_factorized = false;
+        }
+
+        /**
+         * @brief checks if two compressed sparse matrices share the same sparsity pattern
+         */
+        static bool
+        same_pattern( matrix_type const& A, matrix_type const& B )
+        {
+            return A.rows() == B.rows() && A.cols() == B.cols() && A.nonZeros() == B.nonZeros()
+                && std::equal( A.outerIndexPtr(), A.outerIndexPtr() + A.outerSize() + 1, B.outerIndexPtr() )
+                && std::equal( A.innerIndexPtr(), A.innerIndexPtr() + A.nonZeros(), B.innerIndexPtr() );
+        }
+
+        /**
+         * @brief checks if stored factorization is still valid for a given \f$\alpha\f$ and a Jacobian
+         *
+         * @param alpha \f$\alpha = \gamma\Delta t\f$
+         * @param J     Jacobian \f$J_R\f$ of reaction operator (compressed)
+         */
+        bool
+        is_assembled( scalar_t alpha, matrix_type const& J ) const
+        {
+            return is_factorized && alpha == alpha_J_cached && same_pattern( J, J_cached )
+                && std::equal( J.valuePtr(), J.valuePtr() + J.nonZeros(), J_cached.valuePtr() );
+        }
+
+        /**
+         * @brief solves \f$(I - \alpha J_R)^{\ell}X = b\f$
+         *
+         * @tparam ell
+         * @tparam state_t type of state
+         * @param alpha           in Shampine's trick \f$\alpha = \gamma \Delta t\f$
+         * @param J               Jacobian \f$J_R\f$ of reaction operator
+         * @param rhs             right hand side term, \f$b\f$
+         * @param u_tmp           temporary variable
+         * @param shampine_result result of unknown \f$X\f$
+         */
+        template <std::size_t ell, typename state_t>
+        void
+        operator()( scalar_t alpha, matrix_type J, state_t&, state_t& rhs, state_t& u_tmp, state_t& shampine_result )
+        {
+            J.makeCompressed();
+
+            if ( !is_assembled( alpha, J ) )
+            {
+                matrix_type I( J.rows(), J.cols() );
+                I.setIdentity();
+                I_alpha_J = I - alpha * J;
+                I_alpha_J.makeCompressed();
+
+                if ( !is_analyzed || !same_pattern( J, J_cached ) )
+                {
+                    solver.analyzePattern( I_alpha_J );
+                    is_analyzed = true;
+                }
+                solver.factorize( I_alpha_J );
+
+                J_cached       = std::move( J );
+                alpha_J_cached = alpha;
+                is_factorized  = true;
+            }
+
+            if constexpr ( ell == 2 )
+            {
+                u_tmp           = solver.solve( rhs );
+                shampine_result = solver.solve( u_tmp );
+            }
+            else
+            {
+                shampine_result = solver.solve( rhs );
+            }
+        }
+    };
+
+} // namespace ponio::shampine_trick
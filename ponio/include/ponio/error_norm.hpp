@@ -0,0 +1,350 @@
+// Copyright 2022 PONIO TEAM. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "reduction.hpp"
+
+namespace ponio::error_norm
+{
+
+    // ---- kinds of norm -------------------------------------------
+
+    // a kind of norm defines how scaled errors \f$x_i\f$ are accumulated:
+    //  - `accumulate( acc, x )`: accumulates \f$x\f$ in `acc` (without branch, so that loops could be vectorized),
+    //  - `combine( a, b )`: combines two partial accumulations,
+    //  - `all_reduce( u, acc )`: combines accumulations of all processes which share state `u` (see ponio::global_reduction),
+    //  - `finalize( acc, n )`: computes norm from accumulation of `n` values.
+
+    /**
+     * @brief root mean square \f$\sqrt{\frac{1}{N}\sum_i x_i^2}\f$
+     */
+    struct rms
+    {
+        template <typename value_t>
+        static constexpr value_t
+        accumulate( value_t acc, value_t x )
+        {
+            return acc + x * x;
+        }
+
+        template <typename value_t>
+        static constexpr value_t
+        combine( value_t a, value_t b )
+        {
+            return a + b;
+        }
+
+        template <typename state_t, typename value_t>
+        static value_t
+        all_reduce( state_t const& u, value_t acc )
+        {
+            return ::ponio::detail::reduce_sum( u, acc );
+        }
+
+        template <typename value_t>
+        static value_t
+        finalize( value_t acc, value_t n )
+        {
+            using std::sqrt;
+            return sqrt( acc / n );
+        }
+    };
+
+    /**
+     * @brief max norm \f$\max_i x_i\f$
+     */
+    struct max
+    {
+        template <typename value_t>
+        static constexpr value_t
+        accumulate( value_t acc, value_t x )
+        {
+            return std::max( acc, x );
+        }
+
+        template <typename value_t>
+        static constexpr value_t
+        combine( value_t a, value_t b )
+        {
+            return std::max( a, b );
+        }
+
+        template <typename state_t, typename value_t>
+        static value_t
+        all_reduce( state_t const& u, value_t acc )
+        {
+            return ::ponio::detail::reduce_max( u, acc );
+        }
+
+        template <typename value_t>
+        static constexpr value_t
+        finalize( value_t acc, value_t )
+        {
+            return acc;
+        }
+    };
+
+    /**
+     * @brief mean of absolute values \f$\frac{1}{N}\sum_i x_i\f$
+     */
+    struct l1
+    {
+        template <typename value_t>
+        static constexpr value_t
+        accumulate( value_t acc, value_t x )
+        {
+            return acc + x;
+        }
+
+        template <typename value_t>
+        static constexpr value_t
+        combine( value_t a, value_t b )
+        {
+            return a + b;
+        }
+
+        template <typename state_t, typename value_t>
+        static value_t
+        all_reduce( state_t const& u, value_t acc )
+        {
+            return ::ponio::detail::reduce_sum( u, acc );
+        }
+
+        template <typename value_t>
+        static constexpr value_t
+        finalize( value_t acc, value_t n )
+        {
+            return acc / n;
+        }
+    };
+
+    // ---- class weighted_norm -------------------------------------
+
+    /** @class weighted_norm
+     *  @brief error norm of an embedded method computed from scaled errors
+     *  \f[
+     *      x_i = w_{g(i)}\frac{|u^{n+1}_i - \tilde{u}^{n+1}_i|}{a_{tol,g(i)} + r_{tol,g(i)}\max(|u^n_i|, |u^{n+1}_i|)}
+     *  \f]
+     *
+     *  @tparam kind_t  kind of norm (@ref rms, @ref max or @ref l1)
+     *  @tparam value_t type of tolerances and error
+     *
+     *  @details components are split into \f$G\f$ interleaved groups, component \f$i\f$ is in group \f$g(i) = i \bmod G\f$ (for example
+     *  \f$G\f$ species of a chemistry model stored cell by cell). \f$G\f$ is the size of non-empty vectors of tolerances and weights, with
+     *  \f$G = N\f$ each component has its own tolerances. An empty vector of tolerances uses the scalar tolerance of the method, an
+     *  empty vector of weights gives \f$w_g = 1\f$, and a vector of size 1 is used for all groups.
+     */
+    template <typename kind_t = rms, typename value_t = double>
+    struct weighted_norm
+    {
+        using kind_type  = kind_t;
+        using value_type = value_t;
+
+        std::vector<value_t> absolute_tolerances; /**< absolute tolerance of each group (empty to use scalar tolerance of the method) */
+        std::vector<value_t> relative_tolerances; /**< relative tolerance of each group (empty to use scalar tolerance of the method) */
+        std::vector<value_t> group_weights;       /**< weight of each group (empty for a weight of 1) */
+
+        /**
+         * @brief number of groups of components
+         */
+        std::size_t
+        n_groups() const
+        {
+            return std::max( { std::size_t{ 1 }, absolute_tolerances.size(), relative_tolerances.size(), group_weights.size() } );
+        }
+
+        /**
+         * @brief returns `true` if each vector of tolerances and weights is empty, of size 1 or of size `n_groups()`
+         */
+        bool
+        has_valid_sizes() const
+        {
+            auto valid = [G = n_groups()]( std::vector<value_t> const& v )
+            {
+                return v.size() <= 1 || v.size() == G;
+            };
+            return valid( absolute_tolerances ) && valid( relative_tolerances ) && valid( group_weights );
+        }
+
+        /**
+         * @brief returns `true` if this norm is a weighted RMS norm with scalar tolerances (the default norm of methods)
+         */
+        bool
+        is_default() const
+        {
+            return std::same_as<kind_t, rms> && absolute_tolerances.empty() && relative_tolerances.empty() && group_weights.empty();
+        }
+
+        template <typename state_t>
+        value_t
+        operator()( state_t const& un, state_t const& unp1, state_t const& unp1bis, value_t a_tol, value_t r_tol ) const;
+
+        template <typename state_t>
+            requires std::ranges::random_access_range<state_t>
+        value_t
+        operator()( state_t const& un, state_t const& unp1, state_t const& unp1bis, value_t a_tol, value_t r_tol ) const;
+    };
+
+    /**
+     * @brief computes error norm of a scalar state
+     *
+     * @param un      state \f$u^n\f$
+     * @param unp1    state \f$u^{n+1}\f$
+     * @param unp1bis state \f$\tilde{u}^{n+1}\f$
+     * @param a_tol   absolute tolerance of the method (used if no absolute tolerances are given)
+     * @param r_tol   relative tolerance of the method (used if no relative tolerances are given)
+     */
+    template <typename kind_t, typename value_t>
+    template <typename state_t>
+    value_t
+    weighted_norm<kind_t, value_t>::operator()( state_t const& un,
+        state_t const& unp1,
+        state_t const& unp1bis,
+        value_t a_tol,
+        value_t r_tol ) const
+    {
+        using std::abs;
+        using std::max;
+
+        value_t const atol_0 = absolute_tolerances.empty() ? a_tol : absolute_tolerances[0];
+        value_t const rtol_0 = relative_tolerances.empty() ? r_tol : relative_tolerances[0];
+        value_t const w_0    = group_weights.empty() ? static_cast<value_t>( 1 ) : group_weights[0];
+
+        value_t const x = w_0 * abs( unp1 - unp1bis ) / ( atol_0 + rtol_0 * max( abs( un ), abs( unp1 ) ) );
+        return kind_t::finalize( kind_t::accumulate( static_cast<value_t>( 0 ), x ), static_cast<value_t>( 1 ) );
+    }
+
+    /**
+     * @brief computes error norm of a range
+     *
+     * @param un      state \f$u^n\f$
+     * @param unp1    state \f$u^{n+1}\f$
+     * @param unp1bis state \f$\tilde{u}^{n+1}\f$
+     * @param a_tol   absolute tolerance of the method (used if no absolute tolerances are given)
+     * @param r_tol   relative tolerance of the method (used if no relative tolerances are given)
+     *
+     * @details an empty vector of tolerances (or weights), or a vector of size 1, is read with a stride 0, so the loop over components of
+     * a group has no branch. It accumulates in `N_lanes` independent partial results which could be evaluated in SIMD registers.
+     */
+    template <typename kind_t, typename value_t>
+    template <typename state_t>
+        requires std::ranges::random_access_range<state_t>
+    value_t
+    weighted_norm<kind_t, value_t>::operator()( state_t const& un,
+        state_t const& unp1,
+        state_t const& unp1bis,
+        value_t a_tol,
+        value_t r_tol ) const
+    {
+        static constexpr std::size_t N_lanes = 4;
+
+        assert( has_valid_sizes() && "tolerances and weights should be empty, or of size 1, or of size the number of groups" );
+
+        value_t const one = static_cast<value_t>( 1 );
+
+        value_t const* atol = absolute_tolerances.empty() ? &a_tol : absolute_tolerances.data();
+        value_t const* rtol = relative_tolerances.empty() ? &r_tol : relative_tolerances.data();
+        value_t const* w    = group_weights.empty() ? &one : group_weights.data();
+
+        std::size_t const s_atol = absolute_tolerances.size() > 1 ? 1 : 0;
+        std::size_t const s_rtol = relative_tolerances.size() > 1 ? 1 : 0;
+        std::size_t const s_w    = group_weights.size() > 1 ? 1 : 0;
+
+        auto it_un      = std::ranges::cbegin( un );
+        auto it_unp1    = std::ranges::cbegin( unp1 );
+        auto it_unp1bis = std::ranges::cbegin( unp1bis );
+
+        auto const n            = static_cast<std::size_t>( std::ranges::distance( un ) );
+        std::size_t const G     = n_groups();
+        std::size_t const n_max = n - n % G;
+
+        auto scaled_error = [&]( std::size_t i, std::size_t g )
+        {
+            using std::abs;
+            using std::max;
+            auto const d = static_cast<std::ptrdiff_t>( i );
+            return w[g * s_w] * abs( it_unp1[d] - it_unp1bis[d] )
+                 / ( atol[g * s_atol] + rtol[g * s_rtol] * max( abs( it_un[d] ), abs( it_unp1[d] ) ) );
+        };
+
+        std::array<value_t, N_lanes> acc;
+        acc.fill( static_cast<value_t>( 0 ) );
+
+        for ( std::size_t b = 0; b < n_max; b += G )
+        {
+            std::size_t g = 0;
+            for ( ; g + N_lanes <= G; g += N_lanes )
+            {
+                for ( std::size_t l = 0; l < N_lanes; ++l )
+                {
+                    acc[l] = kind_t::accumulate( acc[l], scaled_error( b + g + l, g + l ) );
+                }
+            }
+            for ( ; g < G; ++g )
+            {
+                acc[0] = kind_t::accumulate( acc[0], scaled_error( b + g, g ) );
+            }
+        }
+        // last incomplete group
+        for ( std::size_t i = n_max; i < n; ++i )
+        {
+            acc[0] = kind_t::accumulate( acc[0], scaled_error( i, i - n_max ) );
+        }
+
+        value_t r = acc[0];
+        for ( std::size_t l = 1; l < N_lanes; ++l )
+        {
+            r = kind_t::combine( r, acc[l] );
+        }
+
+        // reduction over all processes (see @ref ponio::global_reduction)
+        r = kind_t::all_reduce( un, r );
+
+        return kind_t::finalize( r, ::ponio::detail::reduce_sum( un, static_cast<value_t>( n ) ) );
+    }
+
+    // ---- *helper* ----
+
+    /**
+     * @brief helper function to build a @ref weighted_norm
+     *
+     * @tparam kind_t  kind of norm (@ref rms, @ref max or @ref l1)
+     * @tparam value_t type of tolerances
+     * @param a_tol    absolute tolerances of each group (empty to use tolerance of the method)
+     * @param r_tol    relative tolerances of each group (empty to use tolerance of the method)
+     * @param weights  weights of each group (empty for a weight of 1)
+     *
+     * @throw std::invalid_argument if a non-empty vector has neither size 1 nor the number of groups (size of the largest vector)
+     *
+     * @code{.cpp}
+     *   // max norm with a tolerance per species (3 species stored cell by cell)
+     *   auto norm = ponio::error_norm::make_weighted_norm<ponio::error_norm::max>( { 1e-8, 1e-6, 1e-10 }, { 1e-5, 1e-5, 1e-5 } );
+     * @endcode
+     */
+    template <typename kind_t = rms, typename value_t = double>
+    weighted_norm<kind_t, value_t>
+    make_weighted_norm( std::vector<value_t> a_tol = {}, std::vector<value_t> r_tol = {}, std::vector<value_t> weights = {} )
+    {
+        weighted_norm<kind_t, value_t> norm{ std::move( a_tol ), std::move( r_tol ), std::move( weights ) };
+        if ( !norm.has_valid_sizes() )
+        {
+            throw std::invalid_argument(
+                "ponio::error_norm::make_weighted_norm: tolerances and weights should be of size 0, 1 or the number of groups" );
+        }
+        return norm;
+    }
+
+} // namespace ponio::error_norm
@@ -0,0 +1,66 @@
+// Copyright 2022 PONIO TEAM. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <type_traits>
+
+#if __has_include( <eigen3/Eigen/Dense>)
+#include <eigen3/Eigen/Dense>
+#elif __has_include( <Eigen/Dense>)
+#include <Eigen/Dense>
+#else
+#error "Eigen should be included"
+#endif
+
+#include "state.hpp"
+
+namespace ponio::expression
+{
+
+    namespace detail
+    {
+        /**
+         * @brief test if an Eigen object is a vector with contiguous elements
+         *
+         * @tparam eigen_t type of Eigen object
+         */
+        template <typename eigen_t>
+        concept is_eigen_contiguous_vector = static_cast<bool>( eigen_t::IsVectorAtCompileTime ) && eigen_t::InnerStrideAtCompileTime == 1;
+
+        template <typename scalar_t, int rows, int cols, int options, int max_rows, int max_cols>
+            requires is_eigen_contiguous_vector<Eigen::Matrix<scalar_t, rows, cols, options, max_rows, max_cols>>
+        struct contiguous_storage<Eigen::Matrix<scalar_t, rows, cols, options, max_rows, max_cols>> // NOLINT(misc-include-cleaner)
+        {
+            template <typename c_t>
+            static auto*
+            data( c_t& c )
+            {
+                return c.data();
+            }
+        };
+
+        template <typename plain_object_t, int map_options, typename stride_t>
+            requires is_eigen_contiguous_vector<Eigen::Map<plain_object_t, map_options, stride_t>>
+        struct contiguous_storage<Eigen::Map<plain_object_t, map_options, stride_t>> // NOLINT(misc-include-cleaner)
+        {
+            template <typename c_t>
+            static auto*
+            data( c_t& c )
+            {
+                return c.data();
+            }
+        };
+    } // namespace detail
+
+    /**
+     * @brief Eigen maps on contiguous vectors use ponio expressions (evaluated by SIMD blocks) instead of Eigen expressions
+     */
+    template <typename plain_object_t, int map_options, typename stride_t>
+        requires detail::is_eigen_contiguous_vector<Eigen::Map<plain_object_t, map_options, stride_t>>
+    struct use_expression<Eigen::Map<plain_object_t, map_options, stride_t>> : std::true_type // NOLINT(misc-include-cleaner)
+    {
+    };
+
+} // namespace ponio::expression
@@ -4,12 +4,25 @@
 
 #pragma once
 
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <span>
+
+#include "../detail.hpp"
 #include "state.hpp"
 #include <petsc.h>
 
 namespace ponio::expression
 {
 
+    /**
+     * @brief leaf of ponio expression on a PETSc `Vec`
+     *
+     * @details an assignment gets the local arrays of all `Vec` of the expression once (`VecGetArray` and `VecGetArrayRead`), evaluates
+     * the expression on these contiguous arrays (by SIMD blocks if possible, see @ref detail::assign_range), and restores them. Indices
+     * are local indices of the process.
+     */
     template <>
     struct state<Vec>
     {
@@ -42,25 +55,28 @@ namespace ponio::expression
             return _reader_data[i];
         }
 
+#if defined( PONIO_USE_SIMD )
+        /**
+         * @brief loads a SIMD block from index `i` of local array (only between `raw_data_open` and `raw_data_close`)
+         *
+         * @tparam simd_t type of SIMD block
+         * @param i       first index of block
+         */
+        template <typename simd_t>
+            requires std::same_as<typename simd_t::value_type, double>
+        simd_t
+        load( std::size_t i ) const
+        {
+            return simd_t( _reader_data + i, detail::element_aligned );
+        }
+#endif
+
         template <typename expression_t>
             requires detail::is_ponio_expression<expression_t>
         state&
         operator=( expression_t& expr )
         {
-            double* _ptr_data;
-            VecGetArray( _data, &_ptr_data );
-
-            expr.raw_data_open();
-
-            for ( std::size_t i = 0ul; i < expr.size(); ++i )
-            {
-                _ptr_data[i] = expr[i];
-            }
-
-            expr.raw_data_close();
-
-            VecRestoreArray( _data, &_ptr_data );
-
+            _assign( expr );
             return *this;
         }
 
@@ -68,29 +84,45 @@ namespace ponio::expression
             requires detail::is_ponio_expression<expression_t>
         state&
         operator=( expression_t&& expr )
+        {
+            _assign( expr );
+            return *this;
+        }
+
+        /**
+         * @brief evaluates expression on local arrays
+         *
+         * @param expr expression
+         */
+        template <typename expression_t>
+        void
+        _assign( expression_t& expr )
         {
             double* _ptr_data;
             VecGetArray( _data, &_ptr_data );
 
             expr.raw_data_open();
 
-            for ( std::size_t i = 0ul; i < expr.size(); ++i )
-            {
-                _ptr_data[i] = expr[i];
-            }
+            std::span<double> local_data( _ptr_data, size() );
+            detail::for_each_range<double>( local_data.size(),
+                [&]( std::size_t begin, std::size_t end )
+                {
+                    detail::assign_range( local_data, expr, begin, end );
+                } );
 
             expr.raw_data_close();
 
             VecRestoreArray( _data, &_ptr_data );
-
-            return *this;
         }
 
+        /**
+         * @brief local size of `Vec` (size of arrays given by `VecGetArray`)
+         */
         std::size_t
         size() const
         {
-            int ssize;
-            VecGetSize( _data, &ssize );
+            PetscInt ssize;
+            VecGetLocalSize( _data, &ssize );
             return static_cast<std::size_t>( ssize );
         }
 
@@ -116,6 +148,7 @@ namespace ponio::expression
         raw_data_close()
         {
             VecRestoreArrayRead( _data, &_reader_data );
+            _reader_data = nullptr;
         }
     };
 
@@ -234,3 +267,61 @@ namespace ponio::expression
         }
     };
 } // namespace ponio::expression
+
+namespace ponio::detail
+{
+
+    /**
+     * @brief linear combinations of stages of PETSc `Vec` computed by PETSc: \f$\texttt{output} = \texttt{init} + \sum_i
+     * \texttt{mul_coeff}a_ib_i\f$ with `VecWAXPY` (one stage), `VecAXPBYPCZ` (two stages) or `VecMAXPY`, stages with a null coefficient
+     * are skipped
+     */
+    template <>
+    struct inner_product_kernel<Vec>
+    {
+        template <std::size_t N, typename value_t, typename ArrayA_t, typename ArrayB_t>
+        static void
+        compute( ArrayA_t const& a, ArrayB_t const& b, Vec const& init, value_t const& mul_coeff, Vec& output )
+        {
+            std::array<PetscScalar, N> alpha;
+            std::array<Vec, N> x;
+
+            PetscInt n = 0;
+            for ( std::size_t i = 0; i < N; ++i )
+            {
+                if ( a[i] != 0 )
+                {
+                    alpha[static_cast<std::size_t>( n )] = static_cast<PetscScalar>( mul_coeff * a[i] );
+                    x[static_cast<std::size_t>( n )]     = b[i];
+                    ++n;
+                }
+            }
+
+            // `VecWAXPY` and `VecAXPBYPCZ` don't accept an output which is also an input
+            if ( n == 1 && output != init )
+            {
+                VecWAXPY( output, alpha[0], x[0], init );
+                return;
+            }
+
+            if ( output != init )
+            {
+                VecCopy( init, output );
+            }
+
+            if ( n == 1 )
+            {
+                VecAXPY( output, alpha[0], x[0] );
+            }
+            else if ( n == 2 )
+            {
+                VecAXPBYPCZ( output, alpha[0], alpha[1], 1., x[0], x[1] );
+            }
+            else if ( n > 2 )
+            {
+                VecMAXPY( output, n, alpha.data(), x.data() );
+            }
+        }
+    };
+
+} // namespace ponio::detail
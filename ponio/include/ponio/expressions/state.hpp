@@ -5,11 +5,38 @@
 #pragma once
 
 #include <algorithm>
+#include <cmath>
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <numeric>
+#include <ranges>
+#include <span>
 #include <type_traits>
+#include <utility>
+#include <valarray>
+#include <vector>
+#include <version>
+
+#if defined( __cpp_lib_mdspan ) && __has_include( <mdspan>)
+#include <mdspan>
+#define PONIO_HAS_MDSPAN
+#endif
+
+#if defined( PONIO_USE_OPENMP )
+#include <omp.h>
+#elif defined( PONIO_USE_PARALLEL_STL )
+#include <execution>
+#include <thread>
+#endif
+
+#if !defined( PONIO_NO_SIMD ) && __has_include( <experimental/simd>)
+#include <experimental/simd>
+#define PONIO_USE_SIMD
+#endif
+
+#include "../ponio_config.hpp"
 
 namespace ponio::expression
 {
@@ -22,7 +49,521 @@ namespace ponio::expression
          */
         template <typename expression_t>
         concept is_ponio_expression = std::same_as<std::true_type, std::integral_constant<bool, expression_t::is_ponio_expression>>;
-    }
+
+        /**
+         * @brief size of chunks of parallel assignment: `n` is split in one chunk per thread, rounded up to a whole number of cache lines
+         * (so two threads never write in the same cache line of an aligned container)
+         *
+         * @tparam value_t type of elements
+         * @param n         number of elements
+         * @param n_threads number of threads
+         */
+        template <typename value_t>
+        constexpr std::size_t
+        chunk_size( std::size_t n, std::size_t n_threads )
+        {
+            constexpr std::size_t line_size         = ::ponio::default_config::cache_line_size;
+            constexpr std::size_t elements_per_line = std::max( std::size_t{ 1 }, line_size / sizeof( value_t ) );
+
+            std::size_t const chunk = ( n + n_threads - 1 ) / std::max( std::size_t{ 1 }, n_threads );
+            return ( ( chunk + elements_per_line - 1 ) / elements_per_line ) * elements_per_line;
+        }
+
+        /**
+         * @brief calls `kernel(begin, end)` on ranges of indices which cover \f$[0, n)\f$
+         *
+         * @tparam value_t type of assigned elements (to align chunks on cache lines)
+         * @param n      number of elements
+         * @param kernel function to call on each range
+         *
+         * @details the whole range is given to `kernel` unless ponio is compiled with `PONIO_USE_OPENMP` (OpenMP static schedule) or
+         * `PONIO_USE_PARALLEL_STL` (`std::execution::par_unseq`), and `n` is at least `ponio::default_config::parallel_assignment_threshold`,
+         * then each thread gets a chunk of indices.
+         */
+        template <typename value_t, typename kernel_t>
+        void
+        for_each_range( std::size_t n, kernel_t&& kernel )
+        {
+#if defined( PONIO_USE_OPENMP )
+            if ( n >= ::ponio::default_config::parallel_assignment_threshold )
+            {
+                std::size_t const chunk = chunk_size<value_t>( n, static_cast<std::size_t>( omp_get_max_threads() ) );
+                auto const n_chunks     = static_cast<std::ptrdiff_t>( ( n + chunk - 1 ) / chunk );
+
+#pragma omp parallel for schedule( static, 1 )
+                for ( std::ptrdiff_t c = 0; c < n_chunks; ++c )
+                {
+                    auto const begin = static_cast<std::size_t>( c ) * chunk;
+                    kernel( begin, std::min( n, begin + chunk ) );
+                }
+                return;
+            }
+#elif defined( PONIO_USE_PARALLEL_STL )
+            if ( n >= ::ponio::default_config::parallel_assignment_threshold )
+            {
+                std::size_t const chunk = chunk_size<value_t>( n, std::max( 1u, std::thread::hardware_concurrency() ) );
+                auto chunks             = std::views::iota( std::size_t{ 0 }, ( n + chunk - 1 ) / chunk );
+
+                std::for_each( std::execution::par_unseq,
+                    chunks.begin(),
+                    chunks.end(),
+                    [&]( std::size_t c )
+                    {
+                        kernel( c * chunk, std::min( n, ( c + 1 ) * chunk ) );
+                    } );
+                return;
+            }
+#endif
+            kernel( std::size_t{ 0 }, n );
+        }
+
+        /**
+         * @brief reduces results of `kernel(begin, end)` on ranges of indices which cover \f$[0, n)\f$, ranges are the same as in @ref
+         * for_each_range
+         *
+         * @tparam value_t type of assigned elements (to align chunks on cache lines)
+         * @param n        number of elements
+         * @param identity identity element of reduction
+         * @param kernel   function which returns partial reduction on a range
+         * @param combine  function to combine two partial reductions
+         */
+        template <typename value_t, typename acc_t, typename kernel_t, typename combine_t>
+        acc_t
+        reduce_ranges( std::size_t n, acc_t identity, kernel_t&& kernel, combine_t&& combine )
+        {
+#if defined( PONIO_USE_OPENMP )
+            if ( n >= ::ponio::default_config::parallel_assignment_threshold )
+            {
+                std::size_t const chunk = chunk_size<value_t>( n, static_cast<std::size_t>( omp_get_max_threads() ) );
+                auto const n_chunks     = static_cast<std::ptrdiff_t>( ( n + chunk - 1 ) / chunk );
+
+                std::vector<acc_t> partials( static_cast<std::size_t>( n_chunks ), identity );
+
+#pragma omp parallel for schedule( static, 1 )
+                for ( std::ptrdiff_t c = 0; c < n_chunks; ++c )
+                {
+                    auto const begin                    = static_cast<std::size_t>( c ) * chunk;
+                    partials[static_cast<std::size_t>( c )] = kernel( begin, std::min( n, begin + chunk ) );
+                }
+                return std::accumulate( partials.begin(), partials.end(), identity, combine );
+            }
+#elif defined( PONIO_USE_PARALLEL_STL )
+            if ( n >= ::ponio::default_config::parallel_assignment_threshold )
+            {
+                std::size_t const chunk = chunk_size<value_t>( n, std::max( 1u, std::thread::hardware_concurrency() ) );
+                auto chunks             = std::views::iota( std::size_t{ 0 }, ( n + chunk - 1 ) / chunk );
+
+                return std::transform_reduce( std::execution::par_unseq,
+                    chunks.begin(),
+                    chunks.end(),
+                    identity,
+                    combine,
+                    [&]( std::size_t c )
+                    {
+                        return kernel( c * chunk, std::min( n, ( c + 1 ) * chunk ) );
+                    } );
+            }
+#endif
+            return combine( identity, kernel( std::size_t{ 0 }, n ) );
+        }
+
+        // ---- SIMD evaluation -----------------------------------------
+
+#if defined( PONIO_USE_SIMD )
+        template <typename value_t>
+        using native_simd = std::experimental::native_simd<value_t>;
+
+        inline constexpr auto element_aligned = std::experimental::element_aligned;
+        inline constexpr auto vector_aligned  = std::experimental::vector_aligned;
+#else
+        struct element_aligned_tag
+        {
+        };
+
+        inline constexpr element_aligned_tag element_aligned{};
+#endif
+
+        // ---- storage of containers -----------------------------------
+
+        /**
+         * @brief access to contiguous storage of elements of a container (customization point), a specialization defines
+         * `static auto* data( container_t& )` which returns a pointer on the first element
+         *
+         * @tparam container_t type of container (without `const`)
+         *
+         * @details this is defined for contiguous ranges (`std::vector`, `std::valarray`, `std::span`, ...), and for `std::mdspan` with an
+         * exhaustive layout (`std::layout_right` or `std::layout_left`), elements are then accessed with a flat index.
+         */
+        template <typename container_t>
+        struct contiguous_storage
+        {
+        };
+
+        template <typename container_t>
+            requires std::ranges::contiguous_range<container_t>
+        struct contiguous_storage<container_t>
+        {
+            template <typename c_t>
+            static auto*
+            data( c_t& c )
+            {
+                return std::ranges::data( c );
+            }
+        };
+
+#if defined( PONIO_HAS_MDSPAN )
+        template <typename T, typename extents_t, typename layout_t, typename accessor_t>
+            requires( std::mdspan<T, extents_t, layout_t, accessor_t>::is_always_exhaustive()
+                      && std::same_as<typename accessor_t::data_handle_type, T*> )
+        struct contiguous_storage<std::mdspan<T, extents_t, layout_t, accessor_t>>
+        {
+            template <typename c_t>
+            static auto*
+            data( c_t& c )
+            {
+                return c.data_handle();
+            }
+        };
+#endif
+
+        /**
+         * @brief test if elements of a container are stored contiguously (see @ref contiguous_storage)
+         *
+         * @tparam container_t type of container
+         */
+        template <typename container_t>
+        concept has_contiguous_storage = requires( container_t& c ) {
+                                             {
+                                                 contiguous_storage<std::remove_const_t<container_t>>::data( c )
+                                                 } -> std::convertible_to<void const*>;
+                                         };
+
+        /**
+         * @brief pointer on the first element of a container with contiguous storage
+         *
+         * @param c container
+         */
+        template <typename container_t>
+            requires has_contiguous_storage<container_t>
+        auto*
+        storage_data( container_t& c )
+        {
+            return contiguous_storage<std::remove_const_t<container_t>>::data( c );
+        }
+
+        /**
+         * @brief type of index of accessor operator of a container: `Index` (Eigen), `size_type` or `difference_type` if they are defined,
+         * `std::size_t` otherwise
+         */
+        template <typename container_t>
+        struct index_type
+        {
+            using type = std::size_t;
+        };
+
+        template <typename container_t>
+            requires requires { typename container_t::Index; }
+        struct index_type<container_t>
+        {
+            using type = typename container_t::Index;
+        };
+
+        template <typename container_t>
+            requires( !requires { typename container_t::Index; } && requires { typename container_t::size_type; } )
+        struct index_type<container_t>
+        {
+            using type = typename container_t::size_type;
+        };
+
+        template <typename container_t>
+            requires( !requires { typename container_t::Index; } && !requires { typename container_t::size_type; }
+                      && requires { typename container_t::difference_type; } )
+        struct index_type<container_t>
+        {
+            using type = typename container_t::difference_type;
+        };
+
+        template <typename container_t>
+        using index_type_t = typename index_type<std::remove_cvref_t<container_t>>::type;
+
+        /**
+         * @brief accesses element `i` of a container: with its accessor operator if it is defined with a single index, otherwise with a
+         * flat index in its contiguous storage (for example a `std::mdspan` of rank greater than 1)
+         *
+         * @param c container
+         * @param i index of element (converted to the index type of the container, see @ref index_type)
+         */
+        template <typename container_t>
+        decltype( auto )
+        element( container_t& c, std::size_t i )
+        {
+            using index_t = index_type_t<container_t>;
+
+            if constexpr ( requires { c[i]; } && std::same_as<index_t, std::size_t> )
+            {
+                return ( c[i] );
+            }
+            else if constexpr ( requires { c[static_cast<index_t>( i )]; } )
+            {
+                return ( c[static_cast<index_t>( i )] );
+            }
+            else
+            {
+                return ( storage_data( c )[i] );
+            }
+        }
+
+        /**
+         * @brief type of elements of a container
+         */
+        template <typename container_t>
+        using element_t = std::remove_cvref_t<decltype( element( std::declval<container_t&>(), std::size_t{ 0 } ) )>;
+
+        /**
+         * @brief test if an expression could be evaluated by SIMD block of type `simd_t` with its `load` member function
+         *
+         * @tparam expression_t type of expression
+         * @tparam simd_t       type of SIMD block
+         */
+        template <typename expression_t, typename simd_t>
+        concept is_simd_loadable = requires( expression_t const& expr, std::size_t i ) {
+                                       {
+                                           expr.template load<simd_t>( i )
+                                           } -> std::same_as<simd_t>;
+                                   };
+
+        /**
+         * @brief view on an expression which returns SIMD blocks with its accessor operator, used to reuse `operation` functions on SIMD
+         * blocks
+         *
+         * @tparam simd_t       type of SIMD block
+         * @tparam expression_t type of expression
+         */
+        template <typename simd_t, typename expression_t>
+        struct simd_view
+        {
+            expression_t const& expr; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+
+            simd_t
+            operator[]( std::size_t i ) const
+            {
+                return expr.template load<simd_t>( i );
+            }
+        };
+
+        /**
+         * @brief assigns an expression into a container on indices \f$[\texttt{begin}, \texttt{end})\f$
+         *
+         * @param data  container to store result
+         * @param expr  expression to evaluate
+         * @param begin first index
+         * @param end   last index (excluded)
+         *
+         * @details if the container is contiguous and all leaves of expression could be loaded by SIMD blocks, the first elements are
+         * computed one by one until the destination is aligned, then the expression is evaluated by SIMD blocks with aligned stores, and
+         * the remaining elements one by one.
+         */
+        template <typename container_t, typename expression_t>
+        void
+        assign_range( container_t& data, expression_t const& expr, std::size_t begin, std::size_t end )
+        {
+            std::size_t i = begin;
+
+#if defined( PONIO_USE_SIMD )
+            if constexpr ( has_contiguous_storage<container_t> )
+            {
+                using value_t = element_t<container_t>;
+
+                if constexpr ( std::is_arithmetic_v<value_t> && is_simd_loadable<expression_t, native_simd<value_t>> )
+                {
+                    using simd_t                    = native_simd<value_t>;
+                    static constexpr std::size_t W  = simd_t::size();
+                    static constexpr auto alignment = std::experimental::memory_alignment_v<simd_t>;
+
+                    value_t* ptr = storage_data( data );
+
+                    while ( i < end && reinterpret_cast<std::uintptr_t>( ptr + i ) % alignment != 0 )
+                    {
+                        element( data, i ) = expr[i];
+                        ++i;
+                    }
+                    for ( ; i + W <= end; i += W )
+                    {
+                        expr.template load<simd_t>( i ).copy_to( ptr + i, vector_aligned );
+                    }
+                }
+            }
+#endif
+
+            for ( ; i < end; ++i )
+            {
+                element( data, i ) = expr[i];
+            }
+        }
+
+        /**
+         * @brief test if a reduction could be evaluated by SIMD block of type `simd_t`
+         *
+         * @tparam reduction_t type of reduction
+         * @tparam simd_t      type of SIMD block
+         */
+        template <typename reduction_t, typename simd_t>
+        concept is_simd_reducible = requires( reduction_t const& red, simd_t acc, std::size_t i ) {
+                                        {
+                                            red.accumulate_block( acc, i )
+                                            } -> std::same_as<simd_t>;
+                                        {
+                                            reduction_t::reduce_block( acc )
+                                            } -> std::same_as<typename reduction_t::value_type>;
+                                    };
+
+        /**
+         * @brief assigns an expression into a container on indices \f$[\texttt{begin}, \texttt{end})\f$ and reduces in the same pass
+         *
+         * @param data  container to store result
+         * @param expr  expression to evaluate
+         * @param red   reduction (it could read elements of `data` already assigned)
+         * @param begin first index
+         * @param end   last index (excluded)
+         *
+         * @details the SIMD evaluation follows @ref assign_range, each element (or block) is reduced right after its assignment.
+         */
+        template <typename container_t, typename expression_t, typename reduction_t>
+        typename reduction_t::value_type
+        assign_and_reduce_range( container_t& data, expression_t const& expr, reduction_t const& red, std::size_t begin, std::size_t end )
+        {
+            auto acc      = red.identity();
+            std::size_t i = begin;
+
+#if defined( PONIO_USE_SIMD )
+            if constexpr ( has_contiguous_storage<container_t> )
+            {
+                using value_t = element_t<container_t>;
+                using simd_t  = native_simd<value_t>;
+
+                if constexpr ( std::is_arithmetic_v<value_t> && std::same_as<value_t, typename reduction_t::value_type>
+                               && is_simd_loadable<expression_t, simd_t> && is_simd_reducible<reduction_t, simd_t> )
+                {
+                    static constexpr std::size_t W  = simd_t::size();
+                    static constexpr auto alignment = std::experimental::memory_alignment_v<simd_t>;
+
+                    value_t* ptr = storage_data( data );
+
+                    while ( i < end && reinterpret_cast<std::uintptr_t>( ptr + i ) % alignment != 0 )
+                    {
+                        element( data, i ) = expr[i];
+                        acc                = red.accumulate( acc, i );
+                        ++i;
+                    }
+
+                    simd_t acc_block( red.identity() );
+                    for ( ; i + W <= end; i += W )
+                    {
+                        expr.template load<simd_t>( i ).copy_to( ptr + i, vector_aligned );
+                        acc_block = red.accumulate_block( acc_block, i );
+                    }
+                    acc = reduction_t::combine( acc, reduction_t::reduce_block( acc_block ) );
+                }
+            }
+#endif
+
+            for ( ; i < end; ++i )
+            {
+                element( data, i ) = expr[i];
+                acc                = red.accumulate( acc, i );
+            }
+
+            return acc;
+        }
+
+        /**
+         * @brief reduces on indices \f$[\texttt{begin}, \texttt{end})\f$
+         *
+         * @param red   reduction
+         * @param begin first index
+         * @param end   last index (excluded)
+         */
+        template <typename reduction_t>
+        typename reduction_t::value_type
+        reduce_range( reduction_t const& red, std::size_t begin, std::size_t end )
+        {
+            auto acc      = red.identity();
+            std::size_t i = begin;
+
+#if defined( PONIO_USE_SIMD )
+            using value_t = typename reduction_t::value_type;
+            using simd_t  = native_simd<value_t>;
+
+            if constexpr ( std::is_arithmetic_v<value_t> && is_simd_reducible<reduction_t, simd_t> )
+            {
+                static constexpr std::size_t W = simd_t::size();
+
+                simd_t acc_block( red.identity() );
+                for ( ; i + W <= end; i += W )
+                {
+                    acc_block = red.accumulate_block( acc_block, i );
+                }
+                acc = reduction_t::combine( acc, reduction_t::reduce_block( acc_block ) );
+            }
+#endif
+
+            for ( ; i < end; ++i )
+            {
+                acc = red.accumulate( acc, i );
+            }
+
+            return acc;
+        }
+    } // namespace detail
+
+    // ---- trait use_expression ------------------------------------
+
+    /**
+     * @brief trait to select ponio expressions to compute linear combinations of stages of a container type (in a single loop without
+     * temporary), instead of operators of the container
+     *
+     * @tparam container_t type of container
+     *
+     * @details it is `true` for `std::vector`, `std::valarray`, `std::span` and `std::mdspan` (with an exhaustive layout), and could be
+     * specialized for other containers.
+     *
+     * @code{.cpp}
+     *   template <>
+     *   struct ponio::expression::use_expression<my_container> : std::true_type
+     *   {
+     *   };
+     * @endcode
+     */
+    template <typename container_t>
+    struct use_expression : std::false_type
+    {
+    };
+
+    template <typename value_t, typename allocator_t>
+    struct use_expression<std::vector<value_t, allocator_t>> : std::true_type
+    {
+    };
+
+    template <typename value_t>
+    struct use_expression<std::valarray<value_t>> : std::true_type
+    {
+    };
+
+    template <typename value_t, std::size_t extent>
+    struct use_expression<std::span<value_t, extent>> : std::true_type
+    {
+    };
+
+#if defined( PONIO_HAS_MDSPAN )
+    template <typename T, typename extents_t, typename layout_t, typename accessor_t>
+        requires detail::has_contiguous_storage<std::mdspan<T, extents_t, layout_t, accessor_t>>
+    struct use_expression<std::mdspan<T, extents_t, layout_t, accessor_t>> : std::true_type
+    {
+    };
+#endif
+
+    template <typename container_t>
+    inline constexpr bool use_expression_v = use_expression<std::remove_cvref_t<container_t>>::value;
 
     /**
      * @brief one of leaf of ponio expression that store a container
@@ -55,14 +596,50 @@ namespace ponio::expression
         auto const&
         operator[]( std::size_t i ) const
         {
-            return _data[i];
+            return detail::element( _data, i );
         }
 
         auto&
         operator[]( std::size_t i )
         {
-            return _data[i];
+            return detail::element( _data, i );
+        }
+
+        /**
+         * @brief loads a SIMD block from index `i` (only for contiguous container of elements of type of SIMD block)
+         *
+         * @tparam simd_t type of SIMD block
+         * @param i       first index of block
+         */
+        template <typename simd_t>
+            requires detail::has_contiguous_storage<container_type>
+                  && std::same_as<detail::element_t<container_type>, typename simd_t::value_type>
+        simd_t
+        load( std::size_t i ) const
+        {
+            return simd_t( detail::storage_data( _data ) + i, detail::element_aligned );
+        }
+
+#if defined( PONIO_USE_SIMD )
+        /**
+         * @brief loads a SIMD block from index `i` of a contiguous container of elements of an other arithmetic type (for example stages
+         * stored in reduced precision), elements are converted into the type of SIMD block
+         *
+         * @tparam simd_t type of SIMD block
+         * @param i       first index of block
+         */
+        template <typename simd_t>
+            requires detail::has_contiguous_storage<container_type> && std::is_arithmetic_v<detail::element_t<container_type>>
+                  && ( !std::same_as<detail::element_t<container_type>, typename simd_t::value_type> )
+        simd_t
+        load( std::size_t i ) const
+        {
+            using stored_t = detail::element_t<container_type>;
+            using block_t  = std::experimental::fixed_size_simd<stored_t, simd_t::size()>;
+
+            return std::experimental::static_simd_cast<simd_t>( block_t( detail::storage_data( _data ) + i, detail::element_aligned ) );
         }
+#endif
 
         /**
          * @brief Compute expression only here in the loop
@@ -75,21 +652,59 @@ namespace ponio::expression
         state&
         operator=( expression_t const& expr )
         {
-            for ( std::size_t i = 0ul; i < expr.size(); ++i )
-            {
-                _data[i] = expr[i];
-            }
+            using value_t = detail::element_t<container_type>;
+
+            detail::for_each_range<value_t>( expr.size(),
+                [&]( std::size_t begin, std::size_t end )
+                {
+                    detail::assign_range( _data, expr, begin, end );
+                } );
 
             return *this;
         }
 
+        /**
+         * @brief computes expression and a reduction in the same loop
+         *
+         * @tparam expression_t type of expression tree
+         * @tparam reduction_t  type of reduction (for example @ref weighted_rms_reduction)
+         * @param expr          expression
+         * @param red           reduction, it could read elements of this state (they are already assigned)
+         * @return result of reduction
+         *
+         * @code{.cpp}
+         *   // computes u = a + dt*b, and its max norm without a second sweep on u
+         *   auto u_max = make_state( u ).assign_and_reduce( make_state( a ) + make_scalar( dt ) * make_state( b ),
+         *       max_norm( make_state( u ) ) );
+         * @endcode
+         */
+        template <typename expression_t, typename reduction_t>
+            requires detail::is_ponio_expression<expression_t>
+        typename reduction_t::value_type
+        assign_and_reduce( expression_t const& expr, reduction_t const& red )
+        {
+            using value_t = detail::element_t<container_type>;
+
+            std::size_t const n = expr.size();
+
+            auto acc = detail::reduce_ranges<value_t>( n,
+                red.identity(),
+                [&]( std::size_t begin, std::size_t end )
+                {
+                    return detail::assign_and_reduce_range( _data, expr, red, begin, end );
+                },
+                reduction_t::combine );
+
+            return red.finalize( acc, n );
+        }
+
         /**
          * @brief returns the size of container
          */
         std::size_t
         size() const
         {
-            return _data.size();
+            return static_cast<std::size_t>( _data.size() );
         }
 
         /**
@@ -156,6 +771,18 @@ namespace ponio::expression
             return _value;
         }
 
+        /**
+         * @brief returns a SIMD block filled with the scalar
+         *
+         * @tparam simd_t type of SIMD block
+         */
+        template <typename simd_t>
+        simd_t
+        load( std::size_t ) const
+        {
+            return simd_t( static_cast<typename simd_t::value_type>( _value ) );
+        }
+
         std::size_t
         size() const
         {
@@ -200,7 +827,8 @@ namespace ponio::expression
     enum struct unary_operation : std::uint8_t
     {
         plus,
-        minus
+        minus,
+        abs
     };
 
     /**
@@ -256,6 +884,23 @@ namespace ponio::expression
         return -lhs[i];
     }
 
+    /**
+     * @brief function to compute \f$|\cdot|\f$
+     *
+     * @tparam op    type of unary operation (here \f$|\cdot|\f$)
+     * @tparam lhs_t type of operand
+     * @param lhs    operand
+     * @param i      index to compute this expression
+     */
+    template <unary_operation op, typename lhs_t>
+        requires equals_unary_op<op, unary_operation::abs>
+    auto
+    operation( lhs_t const& lhs, std::size_t i )
+    {
+        using std::abs;
+        return abs( lhs[i] );
+    }
+
     /**
      * @brief base class to compute unary operation
      *
@@ -281,6 +926,20 @@ namespace ponio::expression
             return operation<op>( lhs, i );
         }
 
+        /**
+         * @brief computes expression on a SIMD block from index `i`
+         *
+         * @tparam simd_t type of SIMD block
+         * @param i       first index of block
+         */
+        template <typename simd_t>
+            requires detail::is_simd_loadable<lhs_t, simd_t>
+        simd_t
+        load( std::size_t i ) const
+        {
+            return operation<op>( detail::simd_view<simd_t, lhs_t>{ lhs }, i );
+        }
+
         std::size_t
         size() const
         {
@@ -328,6 +987,20 @@ namespace ponio::expression
         return unary_op<unary_operation::minus, lhs_t>( lhs );
     }
 
+    /**
+     * @brief helper function to construct a new object `unary_op` for absolute value
+     *
+     * @tparam lhs_t type of operand
+     * @param lhs    operand
+     */
+    template <typename lhs_t>
+        requires detail::is_ponio_expression<lhs_t>
+    unary_op<unary_operation::abs, lhs_t>
+    abs( lhs_t const& lhs )
+    {
+        return unary_op<unary_operation::abs, lhs_t>( lhs );
+    }
+
     /////////////////////////////////////////////////////////////////
     // BINARY OPERATOR
     /////////////////////////////////////////////////////////////////
@@ -337,7 +1010,8 @@ namespace ponio::expression
         add,
         sub,
         mul,
-        div
+        div,
+        max
     };
 
     /**
@@ -349,6 +1023,35 @@ namespace ponio::expression
     template <binary_operation I, binary_operation J>
     concept equals_binary_op = std::same_as<std::true_type, std::integral_constant<bool, I == J>>;
 
+    namespace detail
+    {
+        /**
+         * @brief converts explicitly an element of an operand to the common arithmetic type of both operands of a binary operation
+         *
+         * @tparam other_t type of element of the other operand
+         * @param x        element of the operand
+         *
+         * @details with mixed precision leaves (for example stages stored in `float` and coefficients in `double`) the element in lower
+         * precision is promoted explicitly, other elements are forwarded unchanged.
+         */
+        template <typename other_t, typename value_t>
+        constexpr decltype( auto )
+        promote( value_t&& x )
+        {
+            using v_t = std::remove_cvref_t<value_t>;
+            using o_t = std::remove_cvref_t<other_t>;
+
+            if constexpr ( std::is_arithmetic_v<v_t> && std::is_arithmetic_v<o_t> && !std::same_as<v_t, std::common_type_t<v_t, o_t>> )
+            {
+                return static_cast<std::common_type_t<v_t, o_t>>( x );
+            }
+            else
+            {
+                return std::forward<value_t>( x );
+            }
+        }
+    } // namespace detail
+
     /**
      * @brief base function for binary operators
      *
@@ -376,7 +1079,7 @@ namespace ponio::expression
     auto
     operation( lhs_t const& lhs, rhs_t const& rhs, std::size_t i )
     {
-        return lhs[i] + rhs[i];
+        return detail::promote<decltype( rhs[i] )>( lhs[i] ) + detail::promote<decltype( lhs[i] )>( rhs[i] );
     }
 
     /**
@@ -394,7 +1097,7 @@ namespace ponio::expression
     auto
     operation( lhs_t const& lhs, rhs_t const& rhs, std::size_t i )
     {
-        return lhs[i] - rhs[i];
+        return detail::promote<decltype( rhs[i] )>( lhs[i] ) - detail::promote<decltype( lhs[i] )>( rhs[i] );
     }
 
     /**
@@ -412,7 +1115,7 @@ namespace ponio::expression
     auto
     operation( lhs_t const& lhs, rhs_t const& rhs, std::size_t i )
     {
-        return lhs[i] * rhs[i];
+        return detail::promote<decltype( rhs[i] )>( lhs[i] ) * detail::promote<decltype( lhs[i] )>( rhs[i] );
     }
 
     /**
@@ -430,7 +1133,26 @@ namespace ponio::expression
     auto
     operation( lhs_t const& lhs, rhs_t const& rhs, std::size_t i )
     {
-        return lhs[i] / rhs[i];
+        return detail::promote<decltype( rhs[i] )>( lhs[i] ) / detail::promote<decltype( lhs[i] )>( rhs[i] );
+    }
+
+    /**
+     * @brief function to compute \f$\max(\cdot, \cdot)\f$
+     *
+     * @tparam op    type of binary operation (here \f$\max\f$)
+     * @tparam lhs_t type of left-hand-side
+     * @tparam rhs_t type of right-hand-side
+     * @param lhs    lhs operand
+     * @param rhs    rhs operand
+     * @param i      index to compute expression
+     */
+    template <binary_operation op, typename lhs_t, typename rhs_t>
+        requires equals_binary_op<op, binary_operation::max>
+    auto
+    operation( lhs_t const& lhs, rhs_t const& rhs, std::size_t i )
+    {
+        using std::max;
+        return max( detail::promote<decltype( rhs[i] )>( lhs[i] ), detail::promote<decltype( lhs[i] )>( rhs[i] ) );
     }
 
     /**
@@ -461,6 +1183,20 @@ namespace ponio::expression
             return operation<op>( lhs, rhs, i );
         }
 
+        /**
+         * @brief computes expression on a SIMD block from index `i`
+         *
+         * @tparam simd_t type of SIMD block
+         * @param i       first index of block
+         */
+        template <typename simd_t>
+            requires( detail::is_simd_loadable<lhs_t, simd_t> && detail::is_simd_loadable<rhs_t, simd_t> )
+        simd_t
+        load( std::size_t i ) const
+        {
+            return operation<op>( detail::simd_view<simd_t, lhs_t>{ lhs }, detail::simd_view<simd_t, rhs_t>{ rhs }, i );
+        }
+
         std::size_t
         size() const
         {
@@ -537,4 +1273,290 @@ namespace ponio::expression
     {
         return binary_op<binary_operation::div, lhs_t, rhs_t>( lhs, rhs );
     }
+
+    /**
+     * @brief helper function to construct a new object `binary_op` for element-wise maximum
+     *
+     * @tparam lhs_t lhs type
+     * @tparam rhs_t rhs type
+     */
+    template <typename lhs_t, typename rhs_t>
+        requires( detail::is_ponio_expression<lhs_t> && detail::is_ponio_expression<rhs_t> )
+    binary_op<binary_operation::max, lhs_t, rhs_t>
+    max( lhs_t const& lhs, rhs_t const& rhs )
+    {
+        return binary_op<binary_operation::max, lhs_t, rhs_t>( lhs, rhs );
+    }
+
+    /////////////////////////////////////////////////////////////////
+    // REDUCTION
+    /////////////////////////////////////////////////////////////////
+
+    // a reduction defines a type `value_type` of its result and:
+    //  - `identity()`: identity element of the reduction,
+    //  - `accumulate( acc, i )`: accumulates element `i` in `acc`,
+    //  - `accumulate_block( acc, i )`: (optional) accumulates SIMD block from element `i`, with `reduce_block( acc )` to reduce a block,
+    //  - `combine( a, b )`: combines two partial results (from two ranges of elements),
+    //  - `finalize( acc, n )`: computes result from accumulation on `n` elements.
+
+    /**
+     * @brief reduction to compute dot product \f$\sum_i a_i b_i\f$
+     *
+     * @tparam lhs_t type of first expression
+     * @tparam rhs_t type of second expression
+     */
+    template <typename lhs_t, typename rhs_t>
+        requires( detail::is_ponio_expression<lhs_t> && detail::is_ponio_expression<rhs_t> )
+    struct dot_reduction
+    {
+        using value_type = std::remove_cvref_t<decltype( std::declval<lhs_t const&>()[0] * std::declval<rhs_t const&>()[0] )>;
+
+        lhs_t lhs;
+        rhs_t rhs;
+
+        value_type
+        identity() const
+        {
+            return static_cast<value_type>( 0 );
+        }
+
+        value_type
+        accumulate( value_type acc, std::size_t i ) const
+        {
+            return acc + lhs[i] * rhs[i];
+        }
+
+        template <typename simd_t>
+            requires( detail::is_simd_loadable<lhs_t, simd_t> && detail::is_simd_loadable<rhs_t, simd_t> )
+        simd_t
+        accumulate_block( simd_t acc, std::size_t i ) const
+        {
+            return acc + lhs.template load<simd_t>( i ) * rhs.template load<simd_t>( i );
+        }
+
+#if defined( PONIO_USE_SIMD )
+        template <typename simd_t>
+        static value_type
+        reduce_block( simd_t const& acc )
+        {
+            return std::experimental::reduce( acc );
+        }
+#endif
+
+        static value_type
+        combine( value_type a, value_type b )
+        {
+            return a + b;
+        }
+
+        value_type
+        finalize( value_type acc, std::size_t ) const
+        {
+            return acc;
+        }
+
+        std::size_t
+        size() const
+        {
+            return std::min( lhs.size(), rhs.size() );
+        }
+    };
+
+    /**
+     * @brief reduction to compute max norm \f$\max_i |a_i|\f$
+     *
+     * @tparam expr_t type of expression
+     */
+    template <typename expr_t>
+        requires detail::is_ponio_expression<expr_t>
+    struct max_norm_reduction
+    {
+        using value_type = std::remove_cvref_t<decltype( std::declval<expr_t const&>()[0] )>;
+
+        expr_t expr;
+
+        value_type
+        identity() const
+        {
+            return static_cast<value_type>( 0 );
+        }
+
+        value_type
+        accumulate( value_type acc, std::size_t i ) const
+        {
+            using std::abs;
+            using std::max;
+            return max( acc, abs( expr[i] ) );
+        }
+
+        template <typename simd_t>
+            requires detail::is_simd_loadable<expr_t, simd_t>
+        simd_t
+        accumulate_block( simd_t acc, std::size_t i ) const
+        {
+            using std::abs;
+            using std::max;
+            return max( acc, abs( expr.template load<simd_t>( i ) ) );
+        }
+
+#if defined( PONIO_USE_SIMD )
+        template <typename simd_t>
+        static value_type
+        reduce_block( simd_t const& acc )
+        {
+            return std::experimental::hmax( acc );
+        }
+#endif
+
+        static value_type
+        combine( value_type a, value_type b )
+        {
+            return std::max( a, b );
+        }
+
+        value_type
+        finalize( value_type acc, std::size_t ) const
+        {
+            return acc;
+        }
+
+        std::size_t
+        size() const
+        {
+            return expr.size();
+        }
+    };
+
+    /**
+     * @brief reduction to compute weighted root mean square \f$\sqrt{\frac{1}{N}\sum_i \left(\frac{e_i}{w_i}\right)^2}\f$
+     *
+     * @tparam error_t  type of expression of error \f$e\f$
+     * @tparam weight_t type of expression of weights \f$w\f$
+     */
+    template <typename error_t, typename weight_t>
+        requires( detail::is_ponio_expression<error_t> && detail::is_ponio_expression<weight_t> )
+    struct weighted_rms_reduction
+    {
+        using value_type = std::remove_cvref_t<decltype( std::declval<error_t const&>()[0] / std::declval<weight_t const&>()[0] )>;
+
+        error_t error;
+        weight_t weight;
+
+        value_type
+        identity() const
+        {
+            return static_cast<value_type>( 0 );
+        }
+
+        value_type
+        accumulate( value_type acc, std::size_t i ) const
+        {
+            auto tmp = error[i] / weight[i];
+            return acc + tmp * tmp;
+        }
+
+        template <typename simd_t>
+            requires( detail::is_simd_loadable<error_t, simd_t> && detail::is_simd_loadable<weight_t, simd_t> )
+        simd_t
+        accumulate_block( simd_t acc, std::size_t i ) const
+        {
+            auto tmp = error.template load<simd_t>( i ) / weight.template load<simd_t>( i );
+            return acc + tmp * tmp;
+        }
+
+#if defined( PONIO_USE_SIMD )
+        template <typename simd_t>
+        static value_type
+        reduce_block( simd_t const& acc )
+        {
+            return std::experimental::reduce( acc );
+        }
+#endif
+
+        static value_type
+        combine( value_type a, value_type b )
+        {
+            return a + b;
+        }
+
+        value_type
+        finalize( value_type acc, std::size_t n ) const
+        {
+            using std::sqrt;
+            return sqrt( acc / static_cast<value_type>( n ) );
+        }
+
+        std::size_t
+        size() const
+        {
+            return std::min( error.size(), weight.size() );
+        }
+    };
+
+    /**
+     * @brief helper function to construct a dot product reduction
+     *
+     * @param lhs first expression
+     * @param rhs second expression
+     */
+    template <typename lhs_t, typename rhs_t>
+        requires( detail::is_ponio_expression<lhs_t> && detail::is_ponio_expression<rhs_t> )
+    dot_reduction<lhs_t, rhs_t>
+    dot( lhs_t const& lhs, rhs_t const& rhs )
+    {
+        return { lhs, rhs };
+    }
+
+    /**
+     * @brief helper function to construct a max norm reduction
+     *
+     * @param expr expression
+     */
+    template <typename expr_t>
+        requires detail::is_ponio_expression<expr_t>
+    max_norm_reduction<expr_t>
+    max_norm( expr_t const& expr )
+    {
+        return { expr };
+    }
+
+    /**
+     * @brief helper function to construct a weighted root mean square reduction
+     *
+     * @param error  expression of error
+     * @param weight expression of weights (for example \f$a_{tol} + r_{tol}|u|\f$)
+     */
+    template <typename error_t, typename weight_t>
+        requires( detail::is_ponio_expression<error_t> && detail::is_ponio_expression<weight_t> )
+    weighted_rms_reduction<error_t, weight_t>
+    weighted_rms( error_t const& error, weight_t const& weight )
+    {
+        return { error, weight };
+    }
+
+    /**
+     * @brief evaluates a reduction (in parallel if enabled, and by SIMD blocks when expressions allow it)
+     *
+     * @param red reduction (for example @ref weighted_rms)
+     * @return result of the reduction
+     */
+    template <typename reduction_t>
+    typename reduction_t::value_type
+    reduce( reduction_t const& red )
+    {
+        using value_t = typename reduction_t::value_type;
+
+        std::size_t const n = red.size();
+
+        auto acc = detail::reduce_ranges<value_t>( n,
+            red.identity(),
+            [&]( std::size_t begin, std::size_t end )
+            {
+                return detail::reduce_range( red, begin, end );
+            },
+            reduction_t::combine );
+
+        return red.finalize( acc, n );
+    }
+
 } // namespace ponio::expression
@@ -282,6 +282,24 @@ namespace ponio
         {
             details::increment( std::get<I>( number_of_eval ), evals );
         }
+
+        template <std::size_t... Is>
+        void
+        increment_impl( iteration_info const& other, std::index_sequence<Is...> )
+        {
+            [[maybe_unused]] auto l = { ( details::increment( std::get<Is>( number_of_eval ), std::get<Is>( other.number_of_eval ) ), 0 )... };
+        }
+
+        /**
+         * @brief increment number of evaluations of all operators by ones counted in an other `iteration_info` (from a concurrent sweep)
+         *
+         * @param other `iteration_info` of concurrent sweep
+         */
+        void
+        increment( iteration_info const& other )
+        {
+            increment_impl( other, std::make_index_sequence<std::tuple_size<tuple_t>{}>{} );
+        }
     };
 
     /**
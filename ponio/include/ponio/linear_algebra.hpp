@@ -7,6 +7,9 @@
 #include <cmath>
 #include <concepts>
 #include <cstddef>
+#include <memory>
+#include <typeinfo>
+#include <utility>
 
 namespace ponio::linear_algebra
 {
@@ -40,6 +43,87 @@ namespace ponio::linear_algebra
         }
     };
 
+    /** @class solver_cache
+     *  keeps a solver built on an implicit operator between two time steps of a method
+     *  @details type of stored solver depends on the problem given to the method, not on the method, so it is erased. A copy of a cache is
+     *  empty: solvers are never shared, a copy builds its own solver on first call.
+     */
+    class solver_cache
+    {
+      public:
+
+        solver_cache() = default;
+
+        solver_cache( solver_cache const& )
+            : solver_cache()
+        {
+        }
+
+        solver_cache( solver_cache&& other ) noexcept = default;
+
+        solver_cache&
+        operator=( solver_cache const& other )
+        {
+            if ( this != &other )
+            {
+                reset();
+            }
+            return *this;
+        }
+
+        solver_cache& operator=( solver_cache&& other ) noexcept = default;
+
+        ~solver_cache() = default;
+
+        /**
+         * @brief gets stored object, `nullptr` if cache is empty or stores another type
+         *
+         * @tparam entry_t type of stored object
+         */
+        template <typename entry_t>
+        entry_t*
+        get() const
+        {
+            if ( _entry == nullptr || *_type != typeid( entry_t ) )
+            {
+                return nullptr;
+            }
+            return static_cast<entry_t*>( _entry.get() );
+        }
+
+        /**
+         * @brief destroys stored object and builds a new one
+         *
+         * @tparam entry_t type of stored object
+         * @param args     arguments of constructor of `entry_t`
+         */
+        template <typename entry_t, typename... Args>
+        entry_t&
+        emplace( Args&&... args )
+        {
+            reset();
+            auto entry = std::make_shared<entry_t>( std::forward<Args>( args )... );
+            _entry     = entry;
+            _type      = &typeid( entry_t );
+            return *entry;
+        }
+
+        /**
+         * @brief destroys stored object
+         */
+        void
+        reset()
+        {
+            _entry.reset();
+            _type = nullptr;
+        }
+
+      private:
+
+        std::shared_ptr<void> _entry;
+        std::type_info const* _type = nullptr;
+    };
+
     template <typename state_t>
     struct operator_algebra
     {
@@ -102,4 +186,36 @@ namespace ponio::shampine_trick
 
         static_assert( dependent_false<state_t>, "non implemented Shampine's trick structure for this type" );
     };
+
+    /**
+     * @brief For PIROCK method, compute the Shampine's trick on scalar problems
+     *
+     * @tparam scalar_t type of state
+     */
+    template <typename scalar_t>
+        requires std::floating_point<scalar_t>
+    struct shampine_trick<scalar_t>
+    {
+        /**
+         * @brief solves \f$(1 - \alpha J_R)^{\ell}X = b\f$
+         *
+         * @tparam ell
+         * @param alpha           in Shampine's trick \f$\alpha = \gamma \Delta t\f$
+         * @param J_R             Jacobian \f$J_R\f$ of reaction operator
+         * @param rhs             right hand side term, \f$b\f$
+         * @param shampine_result result of unknown \f$X\f$
+         */
+        template <std::size_t ell>
+        void
+        operator()( scalar_t alpha, scalar_t J_R, scalar_t&, scalar_t& rhs, scalar_t&, scalar_t& shampine_result ) const
+        {
+            scalar_t const inv_J = static_cast<scalar_t>( 1. ) / ( static_cast<scalar_t>( 1. ) - alpha * J_R );
+
+            shampine_result = rhs * inv_J;
+            if constexpr ( ell == 2 )
+            {
+                shampine_result *= inv_J;
+            }
+        }
+    };
 } // namespace ponio::shampine_trick
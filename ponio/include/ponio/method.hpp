@@ -8,11 +8,14 @@
 #include <cmath>
 #include <concepts>
 #include <cstddef>
+#include <memory>
 #include <ranges>
 #include <tuple>
 #include <type_traits>
 
+#include "concurrency.hpp"
 #include "detail.hpp"
+#include "problem.hpp"
 #include "splitting.hpp" // NOLINT(misc-include-cleaner)
 #include "stage.hpp"
 #include "user_defined_method.hpp" // NOLINT(misc-include-cleaner)
@@ -25,6 +28,70 @@ namespace ponio
     template <typename Algorithm_t>
     concept is_implemented_method = stages::has_static_number_of_stages<Algorithm_t> || stages::has_dynamic_number_of_stages<Algorithm_t>;
 
+    ///////////////////////////////////////////////////////////////////////////
+    // scheduler of independent stages
+
+    /** @class stage_scheduler
+     *  @brief evaluates a block of independent stages of a method
+     *
+     *  A problem which provides `f_batch` (see @ref has_f_batch) evaluates the whole block at once. Otherwise, if the scheduler owns a
+     *  pool of threads, stages are shared between threads of the pool and the calling thread, else stages are evaluated one after the
+     *  other.
+     *
+     *  @warning with concurrent evaluation the problem is called from several threads, so it should not modify a shared state (a
+     *  @ref problem with several sub-problems lends its buffers to each call from a thread-safe pool).
+     */
+    struct stage_scheduler
+    {
+        std::shared_ptr<detail::worker_pool> workers; /**< threads which evaluate independent stages (stages are evaluated one after the
+                                                         other if null) */
+
+        stage_scheduler() = default;
+
+        /**
+         * constructor of \ref stage_scheduler
+         *
+         * @param n_concurrent_stages number of stages evaluated concurrently, a pool of `n_concurrent_stages - 1` threads is created
+         * once (no pool for 0 or 1)
+         */
+        explicit stage_scheduler( std::size_t n_concurrent_stages )
+            : workers( n_concurrent_stages > 1 ? std::make_shared<detail::worker_pool>( n_concurrent_stages - 1 ) : nullptr )
+        {
+        }
+
+        /**
+         * evaluates \f$f\f$ on a block of independent stages
+         *
+         * @tparam N number of stages in the block
+         * @param f       problem to evaluate
+         * @param t_list  list of times of each stage
+         * @param u_list  list of pointers on each stage
+         * @param du_list list of pointers on outputs
+         */
+        template <std::size_t N, typename Problem_t, typename value_t, typename state_t>
+        void
+        operator()( Problem_t& f,
+            std::array<value_t, N> const& t_list,
+            std::array<state_t*, N> const& u_list,
+            std::array<state_t*, N> const& du_list ) const
+        {
+            if constexpr ( !has_f_batch<Problem_t, value_t, state_t, N> && N > 1 )
+            {
+                if ( workers != nullptr )
+                {
+                    workers->parallel_for( N,
+                        [&]( std::size_t i )
+                        {
+                            f( t_list[i], *u_list[i], *du_list[i] );
+                        } );
+                    return;
+                }
+            }
+
+            evaluate_batch( f, t_list, u_list, du_list );
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     // method with static number of stages
 
@@ -46,7 +113,13 @@ namespace ponio
         static constexpr bool is_embedded = Algorithm_t::is_embedded;
         static constexpr std::size_t
             step_storage_size = detail::conditional_v<is_embedded, std::size_t, Algorithm_t::N_stages + 2, Algorithm_t::N_stages + 1>;
-        using step_storage_t  = std::array<state_t, step_storage_size>;
+        using stage_state_t   = typename detail::stage_state<Algorithm_t, state_t>::type;
+        using step_storage_t  = std::conditional_t<std::same_as<stage_state_t, state_t>,
+            std::array<state_t, step_storage_size>,
+            detail::mixed_precision_storage<stage_state_t, state_t, Algorithm_t::N_stages, step_storage_size - Algorithm_t::N_stages>>;
+        using state_type      = state_t;
+
+        static constexpr std::size_t storage_size = step_storage_size + 1; // stages and `ui`
 
         Algorithm_t alg;
         step_storage_t kis;
@@ -60,11 +133,29 @@ namespace ponio
          */
         method( Algorithm_t alg_, state_t const& shadow_of_u0 )
             : alg( std::move( alg_ ) )
-            , kis( ::ponio::detail::init_fill_array<std::tuple_size_v<step_storage_t>>( shadow_of_u0 ) )
+            , kis( _init_storage( shadow_of_u0 ) )
             , ui( shadow_of_u0 )
         {
         }
 
+        /**
+         * @brief builds storage of stages from a shadow of \f$u_0\f$
+         *
+         * @param shadow_of_u0 an object with the same size of computed value for allocation
+         */
+        static step_storage_t
+        _init_storage( state_t const& shadow_of_u0 )
+        {
+            if constexpr ( std::same_as<stage_state_t, state_t> )
+            {
+                return ::ponio::detail::init_fill_array<step_storage_size>( shadow_of_u0 );
+            }
+            else
+            {
+                return step_storage_t( shadow_of_u0 );
+            }
+        }
+
         method() = default;
 
         /**
@@ -94,7 +185,7 @@ namespace ponio
         typename std::enable_if<( I == Algorithm_t::N_stages + 1 ), void>::type
         _call_stage( Problem_t& f, value_t tn, state_t& un, value_t dt )
         {
-            alg.stage( Stage<I>{}, f, tn, un, kis, dt, ui, kis[I] );
+            alg.stage( Stage<I>{}, f, tn, un, kis, dt, ui, ::ponio::detail::stage_at<I>( kis ) );
         }
 
         template <std::size_t I = 0, typename Problem_t, typename value_t, typename Algo_t = Algorithm_t>
@@ -118,7 +209,7 @@ namespace ponio
         typename std::enable_if<( I < Algorithm_t::N_stages + 1 ), void>::type
         _call_stage( Problem_t& f, value_t tn, state_t& un, value_t dt )
         {
-            alg.stage( Stage<I>{}, f, tn, un, kis, dt, ui, kis[I] );
+            alg.stage( Stage<I>{}, f, tn, un, kis, dt, ui, ::ponio::detail::stage_at<I>( kis ) );
             _call_stage<I + 1>( f, tn, un, dt );
         }
 
@@ -137,7 +228,7 @@ namespace ponio
         _return( value_t& tn, [[maybe_unused]] state_t& un, value_t& dt, state_t& unp1 )
         {
             tn = tn + dt;
-            std::swap( kis.back(), unp1 );
+            std::swap( ::ponio::detail::stage_at<step_storage_size - 1>( kis ), unp1 );
         }
 
         template <typename value_t, typename Algo_t = Algorithm_t>
@@ -145,15 +236,19 @@ namespace ponio
         void
         _return( value_t& tn, state_t& un, value_t& dt, state_t& unp1 )
         {
-            alg.info().error = ::ponio::detail::error_estimate( un,
-                kis[Algorithm_t::N_stages],
-                kis[Algorithm_t::N_stages + 1],
-                info().absolute_tolerance,
-                info().relative_tolerance );
+            // error could be already computed by the last stage of the algorithm
+            if constexpr ( !requires { requires Algorithm_t::template fuses_error_estimate<state_t>; } )
+            {
+                alg.info().error = ::ponio::detail::error_estimate( un,
+                    ::ponio::detail::stage_at<Algorithm_t::N_stages>( kis ),
+                    ::ponio::detail::stage_at<Algorithm_t::N_stages + 1>( kis ),
+                    info().absolute_tolerance,
+                    info().relative_tolerance );
+            }
             // std::cout << "alg.info().error = " << alg.info().error << std::endl;
 
             value_t new_dt = 0.9 * std::pow( alg.info().tolerance / alg.info().error, 1. / static_cast<value_t>( Algorithm_t::order ) ) * dt;
-            new_dt = std::min( std::max( 0.2 * dt, new_dt ), 5. * dt );
+            new_dt = ::ponio::detail::clamp_time_step( new_dt, dt );
 
             if ( alg.info().error > static_cast<value_t>( 1.0 ) )
             {
@@ -168,7 +263,7 @@ namespace ponio
                 alg.info().success = true;
 
                 tn = tn + dt;
-                std::swap( kis[Algorithm_t::N_stages], unp1 );
+                std::swap( ::ponio::detail::stage_at<Algorithm_t::N_stages>( kis ), unp1 );
                 dt = new_dt;
             }
         }
@@ -221,8 +316,10 @@ namespace ponio
         requires stages::has_dynamic_number_of_stages<Algorithm_t>
     struct method<Algorithm_t, state_t>
     {
-        static constexpr bool is_embedded = Algorithm_t::is_embedded;
-        using step_storage_t              = std::array<state_t, Algorithm_t::N_storage>;
+        static constexpr bool is_embedded         = Algorithm_t::is_embedded;
+        static constexpr std::size_t storage_size = Algorithm_t::N_storage;
+        using step_storage_t                      = std::array<state_t, storage_size>;
+        using state_type                          = state_t;
 
         Algorithm_t alg;
         step_storage_t kis;
@@ -300,6 +397,9 @@ namespace ponio
         static constexpr std::size_t
             step_storage_size = detail::conditional_v<is_embedded, std::size_t, Algorithm_t::N_stages + 2, Algorithm_t::N_stages + 1>;
         using step_storage_t  = std::array<state_t, step_storage_size>;
+        using state_type      = state_t;
+
+        static constexpr std::size_t storage_size = Algorithm_t::N_operators * step_storage_size + 2; // stages, `ui` and `u_tmp`
 
         Algorithm_t alg;
         std::array<step_storage_t, Algorithm_t::N_operators> kis;
@@ -404,7 +504,7 @@ namespace ponio
 
             value_t new_dt = 0.9 * std::pow( static_cast<value_t>( 1.0 ) / alg.info().error, 1. / static_cast<value_t>( Algorithm_t::order ) )
                            * dt;
-            new_dt = std::min( std::max( 0.2 * dt, new_dt ), 5. * dt );
+            new_dt = ::ponio::detail::clamp_time_step( new_dt, dt );
 
             if ( alg.info().error > static_cast<value_t>( 1.0 ) )
             {
@@ -475,7 +575,9 @@ namespace ponio
         requires is_user_method<user_defined_algorithm_t>
     struct method<user_defined_algorithm_t, state_t>
     {
-        static constexpr bool is_embedded = false;
+        static constexpr bool is_embedded         = false;
+        static constexpr std::size_t storage_size = 0;
+        using state_type                          = state_t;
 
         user_defined_algorithm_t alg;
 
@@ -534,6 +636,19 @@ namespace ponio
 
     ///////////////////////////////////////////////////////////////////////////
 
+    /**
+     * @brief number of states allocated by a method built on `Algorithm_t` (temporary stages and internal buffers)
+     *
+     * @tparam Algorithm_t type of the algorithm
+     * @tparam state_t     type of \f$u^n\f$
+     * @details this is the memory footprint of a method in number of copies of the state, algorithms with a dynamic number of stages
+     * (ROCK, RKC, RKL, PIROCK) give it with `N_storage`, other ones store all their stages.
+     */
+    template <typename Algorithm_t, typename state_t>
+    inline constexpr std::size_t storage_size_v = method<Algorithm_t, state_t>::storage_size;
+
+    ///////////////////////////////////////////////////////////////////////////
+
     /**
      *  generic factory to build a method from an algoritm, it only reuses `method`
      *  constructor
@@ -592,14 +707,27 @@ namespace ponio
 
         auto methods = make_tuple_methods<value_t>( algos.algos, shadow_of_u0 );
 
-        if constexpr ( splitting_tuple::has_optional_args )
+        auto splitting_method = [&]()
         {
-            return splitting::detail::make_splitting_from_tuple<_splitting_method_t>( methods, algos.time_steps, algos.optional_arguments );
-        }
-        else
+            if constexpr ( splitting_tuple::has_optional_args )
+            {
+                return splitting::detail::make_splitting_from_tuple<_splitting_method_t>( methods,
+                    algos.time_steps,
+                    algos.optional_arguments );
+            }
+            else
+            {
+                return splitting::detail::make_splitting_from_tuple<_splitting_method_t>( methods, algos.time_steps );
+            }
+        }();
+
+        // splitting methods which need temporary states allocate them once here, like stages of each sub-method
+        if constexpr ( requires { splitting_method.allocate_buffers( shadow_of_u0 ); } )
         {
-            return splitting::detail::make_splitting_from_tuple<_splitting_method_t>( methods, algos.time_steps );
+            splitting_method.allocate_buffers( shadow_of_u0 );
         }
+
+        return splitting_method;
     }
 
     /**
@@ -7,15 +7,23 @@
 // NOLINTBEGIN(misc-include-cleaner)
 
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <condition_variable>
 #include <cstddef>
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <iterator>
 #include <limits>
+#include <mutex>
 #include <ranges>
+#include <thread>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 // NOLINTEND(misc-include-cleaner)
@@ -23,6 +31,24 @@
 namespace ponio::observer
 {
 
+    namespace detail
+    {
+        /**
+         * create parent directory of path if needed and return the path
+         * @param path path of output file
+         */
+        inline std::filesystem::path
+        create_directory_if_needed( std::filesystem::path const& path )
+        {
+            auto parent = path.parent_path();
+            if ( !parent.empty() )
+            {
+                std::filesystem::create_directories( parent );
+            }
+            return path;
+        }
+    } // namespace detail
+
     /** @class capsule
      *  helper to display a value
      *  @tparam state_t   type to display
@@ -157,11 +183,6 @@ namespace ponio::observer
         file_observer( std::filesystem::path const& path );
 
         // file_observer( file_observer const& ) = delete;
-
-      private:
-
-        static std::filesystem::path
-        create_directory_if_needed( std::filesystem::path const& path );
     };
 
     /**
@@ -171,32 +192,294 @@ namespace ponio::observer
      */
     template <typename char_t>
     file_observer<char_t>::file_observer( std::filesystem::path const& path )
-        : out( create_directory_if_needed( path ) )
+        : out( detail::create_directory_if_needed( path ) )
     {
     }
 
     /**
-     * create parent directory of path if needed and return the path
-     * @param path path of output file
+     * litteral to convert a string into \ref file_observer
      */
-    template <typename char_t>
-    std::filesystem::path
-    file_observer<char_t>::create_directory_if_needed( std::filesystem::path const& path )
+    inline file_observer<char> operator""_fobs( char const* str, std::size_t len )
+    {
+        return { std::string_view( str, len ) };
+    }
+
+    /** @class binary_observer
+     *  observer that saves data into a binary columnar file, written by a background thread
+     *  @tparam data_t type of values saved in file (`float` or `double`)
+     *  @details Each call appends a record \f$(t^n, \Delta t, u^n)\f$ into a memory buffer, without any text formatting. When the buffer
+     *  is full, it is swapped with a second buffer and handed to a background thread which writes it into the file, so the solver only
+     *  waits for the disk when both buffers are full.
+     *
+     *  The file starts with a header:
+     *    - magic string `PONIOCOL` (8 bytes),
+     *    - type of values as a NumPy dtype string, with byte order, padded with `\0` (4 bytes, `<f8` for `double` on little-endian),
+     *    - version of format (unsigned integer of 4 bytes),
+     *
+     *  followed by blocks of records. Each block stores its number of records \f$n\f$ and its number of columns \f$m\f$ (unsigned integers
+     *  of 8 bytes) then \f$m\f$ columns of \f$n\f$ values: the column of \f$t^n\f$, the column of \f$\Delta t\f$ then a column for each
+     *  component of \f$u^n\f$. A new block starts when size of state changes. Integers are written with the byte order of values.
+     *
+     *  The Python module `ponio_binary.py` in examples reads this format.
+     */
+    template <typename data_t = double>
+        requires std::floating_point<data_t> && ( sizeof( data_t ) == 4 || sizeof( data_t ) == 8 )
+    class binary_observer
+    {
+      public:
+
+        static constexpr std::uint32_t version           = 1;
+        static constexpr std::size_t default_buffer_size = std::size_t{ 1 } << 22;
+
+        binary_observer( std::filesystem::path const& path, std::size_t buffer_size = default_buffer_size );
+
+        binary_observer( binary_observer const& )            = delete;
+        binary_observer( binary_observer&& )                 = delete;
+        binary_observer& operator=( binary_observer const& ) = delete;
+        binary_observer& operator=( binary_observer&& )      = delete;
+
+        ~binary_observer();
+
+        template <typename state_t, typename value_t>
+        void
+        operator()( value_t tn, state_t const& un, value_t dt );
+
+        void
+        flush();
+
+      private:
+
+        /**
+         * records stored one after the other: \f$(t^n, \Delta t, u^n_0, \dots, u^n_{m-3})\f$
+         */
+        struct block
+        {
+            std::vector<data_t> values;
+            std::size_t n_columns = 0;
+            std::size_t n_records = 0;
+        };
+
+        std::ofstream _out;
+        std::size_t _capacity;
+        block _front;
+        block _back;
+        std::vector<data_t> _columns;
+
+        std::mutex _mutex;
+        std::condition_variable _cv;
+        bool _pending = false;
+        bool _stop    = false;
+        std::thread _writer;
+
+        void
+        _write_header();
+
+        void
+        _submit();
+
+        void
+        _write_loop();
+
+        void
+        _write_block( block const& blk );
+    };
+
+    /**
+     * constructor of \ref binary_observer
+     * @param path        path to the output file
+     * @param buffer_size size in bytes of each of both buffers
+     * @note this class creates folder if needed
+     */
+    template <typename data_t>
+        requires std::floating_point<data_t> && ( sizeof( data_t ) == 4 || sizeof( data_t ) == 8 )
+    binary_observer<data_t>::binary_observer( std::filesystem::path const& path, std::size_t buffer_size )
+        : _out( detail::create_directory_if_needed( path ), std::ios::binary )
+        , _capacity( std::max( std::size_t{ 1 }, buffer_size / sizeof( data_t ) ) )
     {
-        auto parent = path.parent_path();
-        if ( !parent.empty() )
+        _front.values.reserve( _capacity );
+        _back.values.reserve( _capacity );
+        _write_header();
+        _writer = std::thread(
+            [this]()
+            {
+                _write_loop();
+            } );
+    }
+
+    /**
+     * destructor of \ref binary_observer, writes last records and stops background thread
+     */
+    template <typename data_t>
+        requires std::floating_point<data_t> && ( sizeof( data_t ) == 4 || sizeof( data_t ) == 8 )
+    binary_observer<data_t>::~binary_observer()
+    {
+        flush();
         {
-            std::filesystem::create_directories( parent );
+            std::lock_guard<std::mutex> lock( _mutex );
+            _stop = true;
         }
-        return path;
+        _cv.notify_all();
+        _writer.join();
     }
 
     /**
-     * litteral to convert a string into \ref file_observer
+     * call operator to append current state of simulation in buffer: \f$t^n\f$, \f$\Delta t\f$ then each component of \f$u^n\f$
      */
-    inline file_observer<char> operator""_fobs( char const* str, std::size_t len )
+    template <typename data_t>
+        requires std::floating_point<data_t> && ( sizeof( data_t ) == 4 || sizeof( data_t ) == 8 )
+    template <typename state_t, typename value_t>
+    void
+    binary_observer<data_t>::operator()( value_t tn, state_t const& un, value_t dt )
     {
-        return { std::string_view( str, len ) };
+        std::size_t n_columns = 3;
+        if constexpr ( std::ranges::sized_range<state_t> )
+        {
+            n_columns = 2 + static_cast<std::size_t>( std::ranges::size( un ) );
+        }
+
+        if ( _front.n_records != 0 && ( n_columns != _front.n_columns || _front.values.size() + n_columns > _capacity ) )
+        {
+            _submit();
+        }
+
+        _front.n_columns = n_columns;
+        _front.values.push_back( static_cast<data_t>( tn ) );
+        _front.values.push_back( static_cast<data_t>( dt ) );
+        if constexpr ( std::ranges::sized_range<state_t> )
+        {
+            for ( auto const& x : un )
+            {
+                _front.values.push_back( static_cast<data_t>( x ) );
+            }
+        }
+        else
+        {
+            _front.values.push_back( static_cast<data_t>( un ) );
+        }
+        ++_front.n_records;
+    }
+
+    /**
+     * write all records saved in buffers into the file, and wait the end of writing
+     */
+    template <typename data_t>
+        requires std::floating_point<data_t> && ( sizeof( data_t ) == 4 || sizeof( data_t ) == 8 )
+    void
+    binary_observer<data_t>::flush()
+    {
+        if ( _front.n_records != 0 )
+        {
+            _submit();
+        }
+
+        std::unique_lock<std::mutex> lock( _mutex );
+        _cv.wait( lock,
+            [this]()
+            {
+                return !_pending;
+            } );
+        _out.flush();
+    }
+
+    /**
+     * write header of file: magic string, type of values and version of format
+     */
+    template <typename data_t>
+        requires std::floating_point<data_t> && ( sizeof( data_t ) == 4 || sizeof( data_t ) == 8 )
+    void
+    binary_observer<data_t>::_write_header()
+    {
+        std::array<char, 4> const dtype = { ( std::endian::native == std::endian::little ) ? '<' : '>',
+            'f',
+            static_cast<char>( '0' + sizeof( data_t ) ),
+            '\0' };
+
+        _out.write( "PONIOCOL", 8 );
+        _out.write( dtype.data(), dtype.size() );
+        _out.write( reinterpret_cast<char const*>( &version ), sizeof( version ) ); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+
+    /**
+     * hand front buffer to background thread, and get an empty buffer once previous writing is done
+     */
+    template <typename data_t>
+        requires std::floating_point<data_t> && ( sizeof( data_t ) == 4 || sizeof( data_t ) == 8 )
+    void
+    binary_observer<data_t>::_submit()
+    {
+        {
+            std::unique_lock<std::mutex> lock( _mutex );
+            _cv.wait( lock,
+                [this]()
+                {
+                    return !_pending;
+                } );
+            std::swap( _front, _back );
+            _pending = true;
+        }
+        _cv.notify_all();
+
+        _front.values.clear();
+        _front.n_records = 0;
+    }
+
+    /**
+     * loop of background thread: write each handed buffer until observer is destroyed
+     */
+    template <typename data_t>
+        requires std::floating_point<data_t> && ( sizeof( data_t ) == 4 || sizeof( data_t ) == 8 )
+    void
+    binary_observer<data_t>::_write_loop()
+    {
+        std::unique_lock<std::mutex> lock( _mutex );
+        while ( true )
+        {
+            _cv.wait( lock,
+                [this]()
+                {
+                    return _pending || _stop;
+                } );
+            if ( !_pending )
+            {
+                return;
+            }
+
+            // back buffer is only read by this thread until `_pending` is reset
+            lock.unlock();
+            _write_block( _back );
+            lock.lock();
+
+            _pending = false;
+            _cv.notify_all();
+        }
+    }
+
+    /**
+     * write a block: transpose records into columns then write them at once
+     * @param blk block of records
+     */
+    template <typename data_t>
+        requires std::floating_point<data_t> && ( sizeof( data_t ) == 4 || sizeof( data_t ) == 8 )
+    void
+    binary_observer<data_t>::_write_block( block const& blk )
+    {
+        auto const n = static_cast<std::uint64_t>( blk.n_records );
+        auto const m = static_cast<std::uint64_t>( blk.n_columns );
+
+        _columns.resize( blk.values.size() );
+        for ( std::size_t i = 0; i < blk.n_records; ++i )
+        {
+            for ( std::size_t j = 0; j < blk.n_columns; ++j )
+            {
+                _columns[j * blk.n_records + i] = blk.values[i * blk.n_columns + j];
+            }
+        }
+
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+        _out.write( reinterpret_cast<char const*>( &n ), sizeof( n ) );
+        _out.write( reinterpret_cast<char const*>( &m ), sizeof( m ) );
+        _out.write( reinterpret_cast<char const*>( _columns.data() ), static_cast<std::streamsize>( _columns.size() * sizeof( data_t ) ) );
+        // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
     }
 
     /** @class null_observer
@@ -11,4 +11,7 @@ namespace ponio::default_config
     static constexpr double tol                        = 1e-4;
     static constexpr double newton_tolerance           = 1e-10;
     static constexpr std::size_t newton_max_iterations = 50;
+
+    static constexpr std::size_t parallel_assignment_threshold = 1 << 15; // minimal size of a state to assign an expression in parallel
+    static constexpr std::size_t cache_line_size               = 64;      // in bytes, to align chunks of parallel assignment
 }
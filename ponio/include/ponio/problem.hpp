@@ -4,15 +4,69 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <concepts>
 #include <cstddef>
+#include <memory>
+#include <ranges>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 
+#include "concurrency.hpp"
+#include "detail.hpp"
+#include "expressions/state.hpp"
+
 namespace ponio
 {
 
+    // --- BATCH EVALUATION --------------------------------------------------------
+    /**
+     * @brief concept of a problem which evaluates \f$f\f$ on several states at once, with a member function
+     * `f_batch( t_list, u_list, du_list )` that computes `*du_list[i]` \f$= f(\f$`t_list[i]`, `*u_list[i]`\f$)\f$
+     *
+     * @tparam Problem_t type of problem
+     * @tparam value_t   type of time
+     * @tparam state_t   type of state
+     * @tparam N         number of evaluations in the batch
+     */
+    template <typename Problem_t, typename value_t, typename state_t, std::size_t N>
+    concept has_f_batch = requires( Problem_t& pb,
+        std::array<value_t, N> const& t_list,
+        std::array<state_t*, N> const& u_list,
+        std::array<state_t*, N> const& du_list ) { pb.f_batch( t_list, u_list, du_list ); };
+
+    /**
+     * @brief evaluates a problem on a batch of independent states, with `f_batch` if problem provides it, otherwise with one call per
+     * state
+     *
+     * @tparam N number of evaluations in the batch
+     * @param pb      problem to evaluate
+     * @param t_list  list of times
+     * @param u_list  list of pointers on states
+     * @param du_list list of pointers on outputs
+     */
+    template <std::size_t N, typename Problem_t, typename value_t, typename state_t>
+    void
+    evaluate_batch( Problem_t& pb,
+        std::array<value_t, N> const& t_list,
+        std::array<state_t*, N> const& u_list,
+        std::array<state_t*, N> const& du_list )
+    {
+        if constexpr ( has_f_batch<Problem_t, value_t, state_t, N> )
+        {
+            pb.f_batch( t_list, u_list, du_list );
+        }
+        else
+        {
+            for ( std::size_t i = 0; i < N; ++i )
+            {
+                pb( t_list[i], *u_list[i], *du_list[i] );
+            }
+        }
+    }
+
     // --- SIMPLE_PROBLEM ----------------------------------------------------------
     /** @class simple_problem
      *  define a problem with a unique function
@@ -24,9 +78,14 @@ namespace ponio
     struct simple_problem
     {
         Callable_t f;
+        std::size_t number_of_returned_states; /**< number of calls of `f` which return a new state by value (one allocation each) */
 
         simple_problem( Callable_t&& f_ );
 
+        template <typename state_t, typename result_t>
+        void
+        _assign_result( state_t& dy, result_t&& result );
+
         template <typename state_t, typename value_t, typename state_expr_t>
             requires std::invocable<Callable_t, value_t, state_expr_t, state_t&>
         void
@@ -56,6 +115,11 @@ namespace ponio
             requires std::invocable<Callable_t, value_t, state_expr_t>
         void
         operator()( value_t t, state_expr_t const& y, state_t& dy );
+
+        template <typename value_t, typename state_t, std::size_t N>
+            requires has_f_batch<Callable_t, value_t, state_t, N>
+        void
+        f_batch( std::array<value_t, N> const& t_list, std::array<state_t*, N> const& u_list, std::array<state_t*, N> const& du_list );
     };
 
     /**
@@ -65,9 +129,46 @@ namespace ponio
     template <typename Callable_t>
     inline simple_problem<Callable_t>::simple_problem( Callable_t&& f_ )
         : f( std::forward<Callable_t>( f_ ) )
+        , number_of_returned_states( 0 )
     {
     }
 
+    /**
+     * stores result of a callable which returns by value into preallocated `dy`
+     *
+     * @param dy     returns value of \f$f(t, y)\f$ of the problem
+     * @param result value returned by `f`
+     *
+     * @details a ponio expression is evaluated directly in `dy` without temporary state, a new state is moved into `dy` (and counted
+     * in `number_of_returned_states`), and any other expression is assigned to `dy`.
+     */
+    template <typename Callable_t>
+    template <typename state_t, typename result_t>
+    inline void
+    simple_problem<Callable_t>::_assign_result( state_t& dy, result_t&& result )
+    {
+        if constexpr ( ::ponio::expression::detail::is_ponio_expression<std::remove_cvref_t<result_t>> )
+        {
+            ::ponio::expression::make_state( dy ) = result;
+        }
+        else if constexpr ( !std::assignable_from<state_t&, result_t&&> && std::ranges::random_access_range<state_t>
+                            && std::ranges::random_access_range<std::remove_cvref_t<result_t>> )
+        {
+            // result stored in a container of an other type (for example stages in reduced precision)
+            auto const& r                         = result;
+            ::ponio::expression::make_state( dy ) = ::ponio::expression::make_state( r );
+        }
+        else
+        {
+            if constexpr ( std::same_as<std::remove_cvref_t<result_t>, state_t> )
+            {
+                // adaptive Strang splitting may evaluate a sub-problem from two threads
+                std::atomic_ref<std::size_t>( number_of_returned_states ).fetch_add( 1, std::memory_order_relaxed );
+            }
+            dy = std::forward<result_t>( result );
+        }
+    }
+
     /**
      * call operator to evaluate \f$f(t,y)\f$
      * @param t  time value \f$t\f$
@@ -107,7 +208,7 @@ namespace ponio
     inline void
     simple_problem<Callable_t>::operator()( value_t t, state_expr_t&& y, state_t& dy )
     {
-        dy = f( t, std::forward<state_expr_t>( y ) );
+        _assign_result( dy, f( t, std::forward<state_expr_t>( y ) ) );
     }
 
     template <typename Callable_t>
@@ -116,7 +217,7 @@ namespace ponio
     inline void
     simple_problem<Callable_t>::operator()( value_t t, state_expr_t& y, state_t& dy )
     {
-        dy = f( t, y );
+        _assign_result( dy, f( t, y ) );
     }
 
     template <typename Callable_t>
@@ -125,7 +226,25 @@ namespace ponio
     inline void
     simple_problem<Callable_t>::operator()( value_t t, state_expr_t const& y, state_t& dy )
     {
-        dy = f( t, y );
+        _assign_result( dy, f( t, y ) );
+    }
+
+    /**
+     * batch evaluation of \f$f\f$, only available if callable object provides it (see @ref has_f_batch)
+     *
+     * @param t_list  list of times
+     * @param u_list  list of pointers on states
+     * @param du_list list of pointers on outputs
+     */
+    template <typename Callable_t>
+    template <typename value_t, typename state_t, std::size_t N>
+        requires has_f_batch<Callable_t, value_t, state_t, N>
+    inline void
+    simple_problem<Callable_t>::f_batch( std::array<value_t, N> const& t_list,
+        std::array<state_t*, N> const& u_list,
+        std::array<state_t*, N> const& du_list )
+    {
+        f.f_batch( t_list, u_list, du_list );
     }
 
     /**
@@ -233,30 +352,25 @@ namespace ponio
     {
         Callable_explicit_t explicit_part;
         Implicit_problem_t implicit_part;
+        std::shared_ptr<::ponio::detail::buffer_pool> implicit_buffer; /**< preallocated evaluations of implicit part */
 
         imex_problem( Callable_explicit_t&& f_explicit, Implicit_problem_t&& pb_implicit );
 
+        template <typename state_t>
+        void
+        allocate_buffers( state_t const& shadow_of_dy, std::size_t n_concurrent_calls = 1 );
+
+        template <typename state_t>
+        ::ponio::detail::buffer_pool::lease<state_t>
+        _implicit_buffer( state_t const& dy );
+
         template <typename state_t, typename value_t, typename state_expr_t>
         void
-        operator()( value_t t, state_expr_t&& y, state_t& dy )
-        {
-            state_t dy_exp = dy;
-            state_t dy_imp = dy;
-            explicit_part( t, std::forward<state_expr_t>( y ), dy_exp );
-            implicit_part( t, std::forward<state_expr_t>( y ), dy_imp );
-            dy = dy_exp + dy_imp;
-        }
+        operator()( value_t t, state_expr_t&& y, state_t& dy );
 
         template <typename state_t, typename value_t, typename state_expr_t>
         void
-        operator()( value_t t, state_expr_t& y, state_t& dy )
-        {
-            state_t dy_exp = dy;
-            state_t dy_imp = dy;
-            explicit_part( t, y, dy_exp );
-            implicit_part( t, y, dy_imp );
-            dy = dy_exp + dy_imp;
-        }
+        operator()( value_t t, state_expr_t& y, state_t& dy );
     };
 
     /**
@@ -272,7 +386,79 @@ namespace ponio
         Implicit_problem_t&& pb_implicit )
         : explicit_part( std::forward<Callable_explicit_t>( f_explicit ) )
         , implicit_part( std::forward<Implicit_problem_t>( pb_implicit ) )
+        , implicit_buffer( std::make_shared<::ponio::detail::buffer_pool>() )
+    {
+    }
+
+    /**
+     * allocates evaluation of implicit part before any evaluation, it is allocated on first call otherwise
+     *
+     * @param shadow_of_dy       an object with the same size of computed value for allocation
+     * @param n_concurrent_calls number of calls of problem which could run at the same time (each one needs its own evaluation)
+     */
+    template <typename Callable_explicit_t, typename Implicit_problem_t>
+    template <typename state_t>
+    inline void
+    imex_problem<Callable_explicit_t, Implicit_problem_t>::allocate_buffers( state_t const& shadow_of_dy, std::size_t n_concurrent_calls )
+    {
+        implicit_buffer->reserve<state_t>( n_concurrent_calls,
+            [&]()
+            {
+                return shadow_of_dy;
+            } );
+    }
+
+    /**
+     * lends preallocated evaluation of implicit part for one call, it is allocated on first call (or if type of state changes) and
+     * given back when the returned object is destroyed
+     *
+     * @param dy an object with the same size of computed value for allocation
+     */
+    template <typename Callable_explicit_t, typename Implicit_problem_t>
+    template <typename state_t>
+    inline ::ponio::detail::buffer_pool::lease<state_t>
+    imex_problem<Callable_explicit_t, Implicit_problem_t>::_implicit_buffer( state_t const& dy )
+    {
+        return { *implicit_buffer,
+            implicit_buffer->acquire<state_t>(
+                [&]()
+                {
+                    return dy;
+                } ) };
+    }
+
+    /**
+     * call operator
+     *
+     * @param t  time \f$t\f$
+     * @param y  solution \f$y\f$ at time \f$t\f$
+     * @param dy returns sum of explicit and implicit parts evaluated in \f$(t,y)\f$
+     *
+     * @details implicit part is evaluated in a preallocated buffer, then explicit part directly in `dy`, and implicit part is added
+     * in place.
+     */
+    template <typename Callable_explicit_t, typename Implicit_problem_t>
+    template <typename state_t, typename value_t, typename state_expr_t>
+    inline void
+    imex_problem<Callable_explicit_t, Implicit_problem_t>::operator()( value_t t, state_expr_t&& y, state_t& dy )
+    {
+        auto dy_imp_lease = _implicit_buffer( dy );
+        auto& dy_imp      = *dy_imp_lease;
+        implicit_part( t, y, dy_imp );
+        explicit_part( t, std::forward<state_expr_t>( y ), dy );
+        ::ponio::detail::add_in_place( dy, dy_imp );
+    }
+
+    template <typename Callable_explicit_t, typename Implicit_problem_t>
+    template <typename state_t, typename value_t, typename state_expr_t>
+    inline void
+    imex_problem<Callable_explicit_t, Implicit_problem_t>::operator()( value_t t, state_expr_t& y, state_t& dy )
     {
+        auto dy_imp_lease = _implicit_buffer( dy );
+        auto& dy_imp      = *dy_imp_lease;
+        implicit_part( t, y, dy_imp );
+        explicit_part( t, y, dy );
+        ::ponio::detail::add_in_place( dy, dy_imp );
     }
 
     // cppcheck-suppress-begin unusedFunction
@@ -382,15 +568,30 @@ namespace ponio
     {
         static std::size_t const size = sizeof...( Callables_t );
         std::tuple<Callables_t...> system;
+        std::shared_ptr<::ponio::detail::worker_pool> workers; /**< threads which evaluate sub-problems concurrently (if not null) */
+        std::shared_ptr<::ponio::detail::buffer_pool> buffers; /**< preallocated evaluations of sub-problems (except the first one) */
 
         problem( Callables_t... args );
 
+        template <typename state_t>
+        void
+        allocate_buffers( state_t const& shadow_of_dy, std::size_t n_concurrent_calls = 1 );
+
+        template <typename state_t>
+        ::ponio::detail::buffer_pool::lease<std::array<state_t, size - 1>>
+        _components_buffers( state_t const& dy );
+
         template <typename value_t, typename state_t, typename state_expr_t, std::size_t... Is>
-        state_t
-        _sum_components_impl( value_t t, state_expr_t&& y, state_t& dy, std::index_sequence<Is...> );
+        void
+        _call_component( std::size_t i,
+            value_t t,
+            state_expr_t& y,
+            state_t& dy,
+            std::array<state_t, size - 1>& evals,
+            std::index_sequence<Is...> );
 
         template <typename value_t, typename state_t, typename state_expr_t, std::size_t... Is>
-        state_t
+        void
         _sum_components_impl( value_t t, state_expr_t& y, state_t& dy, std::index_sequence<Is...> );
 
         template <typename state_t, typename value_t, typename state_expr_t>
@@ -433,31 +634,114 @@ namespace ponio
     template <typename... Callables_t>
     inline problem<Callables_t...>::problem( Callables_t... args )
         : system( args... )
+        , workers()
+        , buffers( std::make_shared<::ponio::detail::buffer_pool>() )
+    {
+    }
+
+    /**
+     * allocates evaluations of sub-problems before any evaluation, they are allocated on first call otherwise
+     *
+     * @param shadow_of_dy       an object with the same size of computed value for allocation
+     * @param n_concurrent_calls number of calls of problem which could run at the same time (each one needs its own evaluations)
+     */
+    template <typename... Callables_t>
+    template <typename state_t>
+    inline void
+    problem<Callables_t...>::allocate_buffers( state_t const& shadow_of_dy, std::size_t n_concurrent_calls )
     {
+        if constexpr ( size > 1 )
+        {
+            buffers->reserve<std::array<state_t, size - 1>>( n_concurrent_calls,
+                [&]()
+                {
+                    return ::ponio::detail::init_fill_array<size - 1>( shadow_of_dy );
+                } );
+        }
+    }
+
+    /**
+     * lends preallocated evaluations of sub-problems for one call, they are given back when the returned object is destroyed
+     *
+     * @param dy an object with the same size of computed value for allocation (if no evaluations are available)
+     *
+     * @details evaluations are taken from a thread-safe pool, so concurrent calls of problem (from independent stages) never share them.
+     */
+    template <typename... Callables_t>
+    template <typename state_t>
+    inline ::ponio::detail::buffer_pool::lease<std::array<state_t, problem<Callables_t...>::size - 1>>
+    problem<Callables_t...>::_components_buffers( state_t const& dy )
+    {
+        using buffers_t = std::array<state_t, size - 1>;
+
+        return { *buffers,
+            buffers->acquire<buffers_t>(
+                [&]()
+                {
+                    return ::ponio::detail::init_fill_array<size - 1>( dy );
+                } ) };
+    }
+
+    /**
+     * call the `i` sub-problem: the first one is evaluated in `dy`, others in `evals`
+     *
+     * @param i     index of sub-problem
+     * @param t     time \f$t\f$
+     * @param y     solution \f$y\f$ at time \f$t\f$
+     * @param dy    evaluation of first sub-problem
+     * @param evals evaluations of other sub-problems
+     */
+    template <typename... Callables_t>
+    template <typename value_t, typename state_t, typename state_expr_t, std::size_t... Is>
+    inline void
+    problem<Callables_t...>::_call_component( std::size_t i,
+        value_t t,
+        state_expr_t& y,
+        state_t& dy,
+        std::array<state_t, size - 1>& evals,
+        std::index_sequence<Is...> )
+    {
+        if ( i == 0 )
+        {
+            std::get<0>( system )( t, y, dy );
+        }
+        ( ( i == Is + 1 ? static_cast<void>( std::get<Is + 1>( system )( t, y, evals[Is] ) ) : void() ), ... );
     }
 
     /**
      * sum all call of each sub-problem
      *
-     * @tparam Is index sequence to iterate over tuple of sub-problems
+     * @tparam Is index sequence to iterate over tuple of sub-problems (except the first one)
      * @param t  time \f$t\f$
      * @param y  solution \f$y\f$ at time \f$t\f$
      * @param dy returns \f$\sum_i f_i(t,y)\f$
+     *
+     * @details first sub-problem is evaluated in `dy` and others in preallocated buffers (concurrently on `workers` if it is set), then
+     * all evaluations are summed in one pass.
      */
     template <typename... Callables_t>
     template <typename value_t, typename state_t, typename state_expr_t, std::size_t... Is>
-    inline state_t
-    problem<Callables_t...>::_sum_components_impl( value_t t, state_expr_t&& y, state_t& dy, std::index_sequence<Is...> )
+    inline void
+    problem<Callables_t...>::_sum_components_impl( value_t t, state_expr_t& y, state_t& dy, std::index_sequence<Is...> is )
     {
-        return ( call<Is>( t, std::forward<state_t>( y ), dy ) + ... );
-    }
+        auto evals_lease = _components_buffers( dy );
+        auto& evals      = *evals_lease;
 
-    template <typename... Callables_t>
-    template <typename value_t, typename state_t, typename state_expr_t, std::size_t... Is>
-    inline state_t
-    problem<Callables_t...>::_sum_components_impl( value_t t, state_expr_t& y, state_t& dy, std::index_sequence<Is...> )
-    {
-        return ( call<Is>( t, y, dy ) + ... );
+        if ( workers )
+        {
+            workers->parallel_for( size,
+                [&]( std::size_t i )
+                {
+                    _call_component( i, t, y, dy, evals, is );
+                } );
+        }
+        else
+        {
+            std::get<0>( system )( t, y, dy );
+            ( std::get<Is + 1>( system )( t, y, evals[Is] ), ... );
+        }
+
+        dy = ( dy + ... + evals[Is] );
     }
 
     /**
@@ -472,7 +756,14 @@ namespace ponio
     inline void
     problem<Callables_t...>::operator()( value_t t, state_expr_t&& y, state_t& dy )
     {
-        dy = _sum_components_impl( t, std::forward<state_t>( y ), dy, std::make_index_sequence<size>{} );
+        if constexpr ( size == 1 )
+        {
+            std::get<0>( system )( t, std::forward<state_expr_t>( y ), dy );
+        }
+        else
+        {
+            _sum_components_impl( t, y, dy, std::make_index_sequence<size - 1>{} );
+        }
     }
 
     template <typename... Callables_t>
@@ -480,7 +771,14 @@ namespace ponio
     inline void
     problem<Callables_t...>::operator()( value_t t, state_expr_t& y, state_t& dy )
     {
-        dy = _sum_components_impl( t, y, dy, std::make_index_sequence<size>{} );
+        if constexpr ( size == 1 )
+        {
+            std::get<0>( system )( t, y, dy );
+        }
+        else
+        {
+            _sum_components_impl( t, y, dy, std::make_index_sequence<size - 1>{} );
+        }
     }
 
     /**
@@ -496,7 +794,8 @@ namespace ponio
     inline void
     problem<Callables_t...>::operator()( std::integral_constant<std::size_t, I>, value_t t, state_expr_t&& y, state_t& dy )
     {
-        call<I>( t, std::forward<state_t>( y ), dy );
+        // evaluate directly in `dy` instead of `call<I>` which returns a copy of it
+        std::get<I>( system )( t, std::forward<state_expr_t>( y ), dy );
     }
 
     template <typename... Callables_t>
@@ -504,7 +803,7 @@ namespace ponio
     inline void
     problem<Callables_t...>::operator()( std::integral_constant<std::size_t, I>, value_t t, state_expr_t& y, state_t& dy )
     {
-        call<I>( t, y, dy );
+        std::get<I>( system )( t, y, dy );
     }
 
     template <typename... Callables_t>
@@ -512,7 +811,7 @@ namespace ponio
     inline void
     problem<Callables_t...>::operator()( std::integral_constant<std::size_t, I>, value_t t, state_expr_t const& y, state_t& dy )
     {
-        call<I>( t, y, dy );
+        std::get<I>( system )( t, y, dy );
     }
 
     /**
@@ -528,7 +827,7 @@ namespace ponio
     inline state_t
     problem<Callables_t...>::call( value_t t, state_expr_t&& y, state_t& dy )
     {
-        std::get<I>( system )( t, std::forward<state_t>( y ), dy );
+        std::get<I>( system )( t, std::forward<state_expr_t>( y ), dy );
         return dy;
     }
 
@@ -561,4 +860,22 @@ namespace ponio
         return problem<Callables_t...>( f... );
     }
 
+    /**
+     * factory of \ref problem which evaluates its sub-problems concurrently
+     * @param f list of sub-problems
+     *
+     * @details sub-problems are evaluated on a pool of `sizeof...( Callables_t ) - 1` threads created once here, the first one on the
+     * calling thread.
+     *
+     * @warning each sub-problem is called from its own thread, so it should not modify a shared state.
+     */
+    template <typename... Callables_t>
+    problem<Callables_t...>
+    make_parallel_problem( Callables_t... f )
+    {
+        auto pb    = problem<Callables_t...>( f... );
+        pb.workers = std::make_shared<::ponio::detail::worker_pool>( sizeof...( Callables_t ) - 1 );
+        return pb;
+    }
+
 } // namespace ponio
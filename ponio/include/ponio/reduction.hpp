@@ -0,0 +1,105 @@
+// Copyright 2022 PONIO TEAM. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <type_traits>
+
+namespace ponio
+{
+
+    /**
+     * @brief customization point to reduce over all processes a value computed on the local part of a distributed state
+     *
+     * @tparam state_t type of state
+     *
+     * @details ponio computes norms of states (error estimates of adaptive time step methods, residuals of Newton method, norms of power
+     * method of ROCK methods) on the elements of a state it could iterate on. By default this is the whole state, and reductions are
+     * local. For a state distributed over MPI processes, a specialization returns the reduction of local values over all processes, so
+     * each process computes the same error and the same time step:
+     *
+     * @code{.cpp}
+     *   template <>
+     *   struct ponio::global_reduction<my_distributed_vector>
+     *   {
+     *       template <typename value_t>
+     *       static value_t
+     *       sum( my_distributed_vector const& u, value_t local )
+     *       {
+     *           value_t global;
+     *           MPI_Allreduce( &local, &global, 1, MPI_DOUBLE, MPI_SUM, u.communicator() );
+     *           return global;
+     *       }
+     *
+     *       template <typename value_t>
+     *       static value_t
+     *       max( my_distributed_vector const& u, value_t local )
+     *       {
+     *           value_t global;
+     *           MPI_Allreduce( &local, &global, 1, MPI_DOUBLE, MPI_MAX, u.communicator() );
+     *           return global;
+     *       }
+     *   };
+     * @endcode
+     *
+     * Numbers of elements (to compute means) are also reduced with `sum`, as values of type `value_t`.
+     */
+    template <typename state_t>
+    struct global_reduction
+    {
+        /**
+         * @brief sum of local values over all processes
+         *
+         * @param local value computed on local part of state
+         */
+        template <typename value_t>
+        static value_t
+        sum( state_t const&, value_t local )
+        {
+            return local;
+        }
+
+        /**
+         * @brief maximum of local values over all processes
+         *
+         * @param local value computed on local part of state
+         */
+        template <typename value_t>
+        static value_t
+        max( state_t const&, value_t local )
+        {
+            return local;
+        }
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief sum of a local value over all processes which share the state `u` (see @ref ponio::global_reduction)
+         *
+         * @param u     state
+         * @param local value computed on local part of `u`
+         */
+        template <typename state_t, typename value_t>
+        value_t
+        reduce_sum( state_t const& u, value_t local )
+        {
+            return ::ponio::global_reduction<std::remove_cvref_t<state_t>>::sum( u, local );
+        }
+
+        /**
+         * @brief maximum of a local value over all processes which share the state `u` (see @ref ponio::global_reduction)
+         *
+         * @param u     state
+         * @param local value computed on local part of `u`
+         */
+        template <typename state_t, typename value_t>
+        value_t
+        reduce_max( state_t const& u, value_t local )
+        {
+            return ::ponio::global_reduction<std::remove_cvref_t<state_t>>::max( u, local );
+        }
+    } // namespace detail
+
+} // namespace ponio
@@ -39,6 +39,7 @@ namespace ponio::runge_kutta
 // NOLINTBEGIN(misc-include-cleaner)
 
 #include "runge_kutta/butcher_methods.hpp"
+#include "runge_kutta/pirk.hpp"
 #include "runge_kutta/pirock.hpp"
 #include "runge_kutta/rock.hpp"
 
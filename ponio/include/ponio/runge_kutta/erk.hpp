@@ -9,9 +9,12 @@
 #include <concepts>
 #include <cstddef>
 #include <string_view> // NOLINT(misc-include-cleaner)
+#include <type_traits>
+#include <utility>
 
 #include "../butcher_tableau.hpp"
 #include "../detail.hpp"
+#include "../error_norm.hpp"
 #include "../iteration_info.hpp"
 #include "../ponio_config.hpp"
 #include "../stage.hpp" // NOLINT(misc-include-cleaner)
@@ -19,10 +22,20 @@
 namespace ponio::runge_kutta::explicit_runge_kutta
 {
 
-    template <typename tableau_t>
+    /**
+     * @brief explicit Runge-Kutta method
+     *
+     * @tparam tableau_t       type of Butcher tableau
+     * @tparam error_norm_t    type of norm of error estimate for embedded methods (see @ref ponio::error_norm::weighted_norm)
+     * @tparam stage_storage_t type of container of stages \f$k_i\f$ (`void` to store stages in the type of state)
+     */
+    template <typename tableau_t,
+        typename error_norm_t    = error_norm::weighted_norm<error_norm::rms, typename tableau_t::value_t>,
+        typename stage_storage_t = void>
     struct explicit_runge_kutta
     {
         tableau_t butcher;
+        error_norm_t norm;
         static constexpr std::size_t N_stages = tableau_t::N_stages;
         static constexpr bool is_embedded     = butcher::is_embedded_tableau<tableau_t>;
         static constexpr std::size_t order    = tableau_t::order;
@@ -30,16 +43,29 @@ namespace ponio::runge_kutta::explicit_runge_kutta
 
         using value_t = typename tableau_t::value_t;
 
-        explicit_runge_kutta( double tolerance = default_config::tol )
+        /**
+         * @brief error estimate is computed by the last stage (in the same loop for the default norm and a range of arithmetic values)
+         */
+        template <typename state_t>
+        static constexpr bool fuses_error_estimate = is_embedded;
+
+        /**
+         * @brief type of stages \f$k_i\f$ for a state of type `state_t`, solution and error estimate are still computed in `state_t`
+         */
+        template <typename state_t>
+        using stage_state = std::conditional_t<std::is_void_v<stage_storage_t>, state_t, stage_storage_t>;
+
+        explicit_runge_kutta( double tolerance = default_config::tol, error_norm_t norm_ = error_norm_t() )
             : butcher()
-            , _info( tolerance )
+            , norm( std::move( norm_ ) )
+            , _info( static_cast<value_t>( tolerance ) )
         {
             _info.number_of_eval = N_stages;
         }
 
-        template <typename problem_t, typename state_t, typename array_kj_t, std::size_t I>
+        template <typename problem_t, typename state_t, typename array_kj_t, typename stage_t, std::size_t I>
         void
-        stage( Stage<I>, problem_t& f, value_t tn, state_t& un, array_kj_t const& Kj, value_t dt, state_t& ui, state_t& Ki )
+        stage( Stage<I>, problem_t& f, value_t tn, state_t& un, array_kj_t const& Kj, value_t dt, state_t& ui, stage_t& Ki )
         {
             // ui = un + dt*sum(butcher.A[I]*Kj)
             detail::tpl_inner_product<I>( butcher.A[I], Kj, un, dt, ui );
@@ -62,7 +88,25 @@ namespace ponio::runge_kutta::explicit_runge_kutta
         stage( Stage<N_stages + 1>, problem_t&, value_t, state_t& un, array_kj_t const& Kj, value_t dt, state_t&, state_t& Ki )
         {
             // Ki = un + dt*sum(butcher.b2*Kj)
+            if constexpr ( detail::has_fused_error_estimate<state_t> )
+            {
+                if ( norm.is_default() )
+                {
+                    // error between Kj[N_stages] = u^{n+1} and Ki is computed while Ki is assigned
+                    _info.error = detail::tpl_inner_product_and_error<N_stages>( butcher.b2,
+                        Kj,
+                        un,
+                        dt,
+                        Ki,
+                        detail::stage_at<N_stages>( Kj ),
+                        _info.absolute_tolerance,
+                        _info.relative_tolerance );
+                    return;
+                }
+            }
+
             detail::tpl_inner_product<N_stages>( butcher.b2, Kj, un, dt, Ki );
+            _info.error = norm( un, detail::stage_at<N_stages>( Kj ), Ki, _info.absolute_tolerance, _info.relative_tolerance );
         }
 
         /**
@@ -113,6 +157,41 @@ namespace ponio::runge_kutta::explicit_runge_kutta
             return *this;
         }
 
+        /**
+         * @brief set norm of error estimate in chained config
+         *
+         * @param new_norm norm of error estimate (for example @ref ponio::error_norm::make_weighted_norm)
+         * @return a new explicit Runge-Kutta method with the same tableau and tolerances
+         */
+        template <typename new_error_norm_t, typename tab_t = tableau_t>
+            requires std::same_as<tab_t, tableau_t> && is_embedded
+        auto
+        error_norm( new_error_norm_t new_norm ) const
+        {
+            explicit_runge_kutta<tableau_t, new_error_norm_t, stage_storage_t> algo( _info.tolerance, std::move( new_norm ) );
+            algo.info() = _info;
+            return algo;
+        }
+
+        /**
+         * @brief set type of container of stages in chained config (for example to store stages in reduced precision)
+         *
+         * @tparam new_stage_storage_t type of container of stages, it should be constructible from a pair of iterators on state
+         * @return a new explicit Runge-Kutta method with the same tableau, norm and tolerances
+         *
+         * @code{.cpp}
+         *   auto meth = ponio::runge_kutta::rk_44().stage_storage<std::vector<float>>();
+         * @endcode
+         */
+        template <typename new_stage_storage_t>
+        auto
+        stage_storage() const
+        {
+            explicit_runge_kutta<tableau_t, error_norm_t, new_stage_storage_t> algo( _info.tolerance, norm );
+            algo.info() = _info;
+            return algo;
+        }
+
         iteration_info<tableau_t> _info;
     };
 
@@ -109,7 +109,7 @@ namespace ponio::runge_kutta::exponential_runge_kutta
 
         explicit_exp_rk_butcher( double tolerance = ponio::default_config::tol )
             : butcher()
-            , _info( tolerance )
+            , _info( static_cast<value_t>( tolerance ) )
         {
             _info.number_of_eval = N_stages;
         }
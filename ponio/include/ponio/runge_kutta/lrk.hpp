@@ -46,7 +46,7 @@ namespace ponio::runge_kutta::lawson_runge_kutta
         explicit_runge_kutta( exp_t exp_, double tolerance = ponio::default_config::tol )
             : lawson_base<exp_t>( exp_ )
             , butcher()
-            , _info( tolerance )
+            , _info( static_cast<value_t>( tolerance ) )
         {
             _info.number_of_eval = N_stages;
         }
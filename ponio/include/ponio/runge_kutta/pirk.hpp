@@ -0,0 +1,237 @@
+// Copyright 2022 PONIO TEAM. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+// IWYU pragma: private
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <string_view> // NOLINT(misc-include-cleaner)
+
+#include "../butcher_tableau.hpp"
+#include "../detail.hpp"
+#include "../iteration_info.hpp"
+#include "../method.hpp"
+#include "../stage.hpp" // NOLINT(misc-include-cleaner)
+
+namespace ponio::runge_kutta::parallel_iterated_runge_kutta
+{
+
+    // NOLINTBEGIN(modernize-use-std-numbers)
+
+    /**
+     * @brief Butcher tableau of Gauss-Legendre method with 2 stages (order 4), used as corrector
+     * @tparam value_t type of coefficient (``double`` by default)
+     *
+     * \f[
+     *  \begin{array}{c|cc}
+     *      \frac{1}{2} - \frac{\sqrt{3}}{6} & \frac{1}{4} & \frac{1}{4} - \frac{\sqrt{3}}{6} \\
+     *      \frac{1}{2} + \frac{\sqrt{3}}{6} & \frac{1}{4} + \frac{\sqrt{3}}{6} & \frac{1}{4} \\
+     *    \hline
+     *      & \frac{1}{2} & \frac{1}{2}
+     *  \end{array}
+     * \f]
+     */
+    template <typename value_t = double>
+    struct butcher_gauss_legendre_2 : public butcher::butcher_tableau<2, value_t>
+    {
+        using base_t                          = butcher::butcher_tableau<2, value_t>;
+        static constexpr std::size_t N_stages = base_t::N_stages;
+        static constexpr std::size_t order    = 4;
+        static constexpr std::string_view id  = "pirk_gauss_legendre_2";
+
+        static constexpr value_t sqrt3_6 = 0.28867513459481287; // sqrt(3)/6
+
+        using base_t::A;
+        using base_t::b;
+        using base_t::c;
+
+        butcher_gauss_legendre_2()
+            : base_t( { { { 0.25, 0.25 - sqrt3_6 }, { 0.25 + sqrt3_6, 0.25 } } }, // A
+                  { 0.5, 0.5 },                                                  // b
+                  { 0.5 - sqrt3_6, 0.5 + sqrt3_6 } )                             // c
+        {
+        }
+    };
+
+    /**
+     * @brief Butcher tableau of Radau IIA method with 3 stages (order 5), used as corrector
+     * @tparam value_t type of coefficient (``double`` by default)
+     *
+     * \f[
+     *  \begin{array}{c|ccc}
+     *      \frac{4 - \sqrt{6}}{10} & \frac{88 - 7\sqrt{6}}{360} & \frac{296 - 169\sqrt{6}}{1800} & \frac{-2 + 3\sqrt{6}}{225} \\
+     *      \frac{4 + \sqrt{6}}{10} & \frac{296 + 169\sqrt{6}}{1800} & \frac{88 + 7\sqrt{6}}{360} & \frac{-2 - 3\sqrt{6}}{225} \\
+     *      1 & \frac{16 - \sqrt{6}}{36} & \frac{16 + \sqrt{6}}{36} & \frac{1}{9} \\
+     *    \hline
+     *      & \frac{16 - \sqrt{6}}{36} & \frac{16 + \sqrt{6}}{36} & \frac{1}{9}
+     *  \end{array}
+     * \f]
+     */
+    template <typename value_t = double>
+    struct butcher_radau_iia_3 : public butcher::butcher_tableau<3, value_t>
+    {
+        using base_t                          = butcher::butcher_tableau<3, value_t>;
+        static constexpr std::size_t N_stages = base_t::N_stages;
+        static constexpr std::size_t order    = 5;
+        static constexpr std::string_view id  = "pirk_radau_iia_3";
+
+        static constexpr value_t sqrt6 = 2.4494897427831781;
+
+        using base_t::A;
+        using base_t::b;
+        using base_t::c;
+
+        butcher_radau_iia_3()
+            : base_t( { { { ( 88. - 7. * sqrt6 ) / 360., ( 296. - 169. * sqrt6 ) / 1800., ( -2. + 3. * sqrt6 ) / 225. },
+                          { ( 296. + 169. * sqrt6 ) / 1800., ( 88. + 7. * sqrt6 ) / 360., ( -2. - 3. * sqrt6 ) / 225. },
+                          { ( 16. - sqrt6 ) / 36., ( 16. + sqrt6 ) / 36., 1. / 9. } } }, // A
+                  { ( 16. - sqrt6 ) / 36., ( 16. + sqrt6 ) / 36., 1. / 9. },         // b
+                  { ( 4. - sqrt6 ) / 10., ( 4. + sqrt6 ) / 10., 1. } )               // c
+        {
+        }
+    };
+
+    // NOLINTEND(modernize-use-std-numbers)
+
+    /** @class parallel_iterated_runge_kutta
+     *  @brief parallel iterated Runge-Kutta method: fixed-point iterations on stages of an implicit (collocation) Runge-Kutta method
+     *
+     *  @tparam tableau_t    Butcher tableau of the corrector (for example @ref butcher_radau_iia_3)
+     *  @tparam N_iterations number of fixed-point iterations
+     *
+     *  @details starting from \f$k_i^{(0)} = f(t^n, u^n)\f$, each iteration computes
+     *  \f[
+     *      k_i^{(m)} = f\left(t^n + c_i\Delta t, u^n + \Delta t\sum_j a_{ij}k_j^{(m-1)}\right), \quad i = 1, \dots, s
+     *  \f]
+     *  and \f$u^{n+1} = u^n + \Delta t\sum_j b_j k_j^{(M)}\f$. The \f$s\f$ evaluations of an iteration are independent, so they are given
+     *  as a block to a @ref ponio::stage_scheduler which can evaluate them concurrently. The order of the method is
+     *  \f$\min(p, M+1)\f$, with \f$p\f$ the order of the corrector and \f$M\f$ the number of iterations.
+     */
+    template <typename tableau_t, std::size_t N_iterations = tableau_t::order - 1>
+    struct parallel_iterated_runge_kutta
+    {
+        static_assert( N_iterations > 0, "Number of iterations should be at least 1 in parallel iterated Runge-Kutta method" );
+
+        static constexpr std::size_t N_corrector_stages = tableau_t::N_stages;
+        static constexpr std::size_t N_stages           = stages::dynamic;
+        static constexpr std::size_t N_storage          = 2 * N_corrector_stages; // stages and their arguments
+        static constexpr std::size_t order              = std::min( tableau_t::order, N_iterations + 1 );
+        static constexpr std::string_view id            = tableau_t::id;
+        static constexpr bool is_embedded               = false;
+        using value_t                                   = typename tableau_t::value_t;
+
+        tableau_t butcher;
+        stage_scheduler scheduler;
+        iteration_info<parallel_iterated_runge_kutta> _info;
+
+        /**
+         * @brief Construct a new parallel iterated Runge-Kutta algorithm
+         *
+         * @param concurrent_stages evaluates independent stages of each iteration concurrently, on a pool of threads created once
+         */
+        parallel_iterated_runge_kutta( bool concurrent_stages = false )
+            : butcher()
+            , scheduler( concurrent_stages ? N_corrector_stages : 0 )
+            , _info()
+        {
+            _info.number_of_stages = 1 + N_iterations * N_corrector_stages;
+            _info.number_of_eval   = 1 + N_iterations * N_corrector_stages;
+        }
+
+        /**
+         * @brief iteration of parallel iterated Runge-Kutta method
+         *
+         * @tparam problem_t  type of operator \f$f\f$
+         * @tparam state_t    type of current state
+         * @tparam array_ki_t type of temporary stages
+         * @param f    operator \f$f\f$
+         * @param tn   current time
+         * @param un   current state
+         * @param G    array of temporary stages, \f$k_i\f$ in the first half and their arguments in the second half
+         * @param dt   current time step
+         * @param unp1 solution \f$u^{n+1}\f$ at time \f$t^{n+1} = t^n + \Delta t\f$
+         */
+        template <typename problem_t, typename state_t, typename array_ki_t>
+        void
+        operator()( problem_t& f, value_t& tn, state_t& un, array_ki_t& G, value_t& dt, state_t& unp1 )
+        {
+            std::array<value_t, N_corrector_stages> t_list;
+            std::array<state_t*, N_corrector_stages> u_list;
+            std::array<state_t*, N_corrector_stages> k_list;
+            for ( std::size_t i = 0; i < N_corrector_stages; ++i )
+            {
+                t_list[i] = tn + butcher.c[i] * dt;
+                u_list[i] = &G[N_corrector_stages + i];
+                k_list[i] = &G[i];
+            }
+
+            f( tn, un, G[0] );
+            for ( std::size_t i = 1; i < N_corrector_stages; ++i )
+            {
+                G[i] = G[0];
+            }
+
+            for ( std::size_t m = 0; m < N_iterations; ++m )
+            {
+                // all arguments are computed before stages are overwritten
+                for ( std::size_t i = 0; i < N_corrector_stages; ++i )
+                {
+                    detail::tpl_inner_product<N_corrector_stages>( butcher.A[i], G, un, dt, *u_list[i] );
+                }
+
+                scheduler( f, t_list, u_list, k_list );
+            }
+
+            detail::tpl_inner_product<N_corrector_stages>( butcher.b, G, un, dt, unp1 );
+            tn = tn + dt;
+        }
+
+        /**
+         * @brief gets `iteration_info` object
+         */
+        auto&
+        info()
+        {
+            return _info;
+        }
+
+        /**
+         * @brief gets `iteration_info` object (constant version)
+         */
+        auto const&
+        info() const
+        {
+            return _info;
+        }
+    };
+
+} // namespace ponio::runge_kutta::parallel_iterated_runge_kutta
+
+namespace ponio::runge_kutta
+{
+
+    /**
+     * @brief parallel iterated Runge-Kutta method with Gauss-Legendre corrector with 2 stages (order 4, 3 iterations, 7 evaluations)
+     * @tparam value_t type of coefficient (``double`` by default)
+     */
+    template <typename value_t>
+    using pirk_gauss_4_t = parallel_iterated_runge_kutta::parallel_iterated_runge_kutta<
+        parallel_iterated_runge_kutta::butcher_gauss_legendre_2<value_t>>;
+
+    using pirk_gauss_4 = pirk_gauss_4_t<double>;
+
+    /**
+     * @brief parallel iterated Runge-Kutta method with Radau IIA corrector with 3 stages (order 5, 4 iterations, 13 evaluations)
+     * @tparam value_t type of coefficient (``double`` by default)
+     */
+    template <typename value_t>
+    using pirk_radau_5_t = parallel_iterated_runge_kutta::parallel_iterated_runge_kutta<
+        parallel_iterated_runge_kutta::butcher_radau_iia_3<value_t>>;
+
+    using pirk_radau_5 = pirk_radau_5_t<double>;
+
+} // namespace ponio::runge_kutta
@@ -8,11 +8,13 @@
 
 // NOLINTBEGIN(misc-include-cleaner)
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <concepts>
 #include <cstddef>
 #include <numbers>
-#include <numeric>
+#include <ranges>
 #include <string_view>
 #include <tuple>
 #include <type_traits>
@@ -153,6 +155,96 @@ namespace ponio::runge_kutta::pirock
         }
     };
 
+    /**
+     * @brief gets linear part \f$J_R\f$ of reaction operator for Shampine's trick: the operator itself if reaction is given as a linear
+     * operator, else its Jacobian \f$\partial_u F_R(u)\f$
+     *
+     * @tparam value_t   type of time
+     * @tparam problem_t type of reaction problem
+     * @tparam state_t   type of current state
+     * @param pb_R reaction problem
+     * @param tn   current time
+     * @param u    state where Jacobian is evaluated
+     */
+    template <typename value_t, typename problem_t, typename state_t>
+    auto
+    reaction_linear_part( problem_t& pb_R, value_t tn, state_t& u )
+    {
+        if constexpr ( ::ponio::detail::problem_operator<problem_t, value_t> )
+        {
+            return pb_R.f_t( tn );
+        }
+        else
+        {
+            return pb_R.df( tn, u );
+        }
+    }
+
+#ifndef IN_DOXYGEN
+    template <typename err_t, typename value_t>
+        requires( !std::ranges::range<err_t> && !::ponio::detail::has_array_range<err_t> )
+    value_t
+    error_sum( err_t const& err, err_t const& un, err_t const& unp1, value_t a_tol, value_t r_tol )
+    {
+        using namespace std;
+        return ::ponio::detail::power<2>( err / ( a_tol + r_tol * max( abs( un ), abs( unp1 ) ) ) );
+    }
+#endif
+
+    /**
+     * @brief computes \f$\sum_i \left(\frac{e_i}{a_{tol} + r_{tol}\max(|u^n_i|, |u^{n+1}_i|)}\right)^2\f$ on local elements of ranges
+     */
+    template <typename err_t, typename value_t>
+        requires std::ranges::range<err_t>
+    value_t
+    local_error_sum( err_t const& err, err_t const& un, err_t const& unp1, value_t a_tol, value_t r_tol )
+    {
+        auto it_un   = std::ranges::cbegin( un );
+        auto it_unp1 = std::ranges::cbegin( unp1 );
+
+        auto r = static_cast<value_t>( 0. );
+
+        using namespace std;
+        for ( auto it_err = std::ranges::cbegin( err ); it_err != std::ranges::cend( err ); ++it_err, ++it_un, ++it_unp1 )
+        {
+            r += ::ponio::detail::power<2>( *it_err / ( a_tol + r_tol * max( abs( *it_un ), abs( *it_unp1 ) ) ) );
+        }
+
+        return r;
+    }
+
+    /**
+     * @brief computes \f$\sum_i \left(\frac{e_i}{a_{tol} + r_{tol}\max(|u^n_i|, |u^{n+1}_i|)}\right)^2\f$ for embedded PIROCK methods
+     *
+     * @tparam err_t   type of state (a range or a scalar, see other overloads)
+     * @tparam value_t type of tolerances
+     * @param err   local error \f$e\f$
+     * @param un    state \f$u^n\f$
+     * @param unp1  state \f$u^{n+1}\f$
+     * @param a_tol absolute tolerance
+     * @param r_tol relative tolerance
+     *
+     * @details the sum is computed over all processes which share the state (see @ref ponio::global_reduction)
+     */
+    template <typename err_t, typename value_t>
+        requires std::ranges::range<err_t>
+    value_t
+    error_sum( err_t const& err, err_t const& un, err_t const& unp1, value_t a_tol, value_t r_tol )
+    {
+        return ::ponio::detail::reduce_sum( err, local_error_sum( err, un, unp1, a_tol, r_tol ) );
+    }
+
+#ifndef IN_DOXYGEN
+    // same with something which contains a range
+    template <typename err_t, typename value_t>
+        requires( !std::ranges::range<err_t> && ::ponio::detail::has_array_range<err_t> )
+    value_t
+    error_sum( err_t const& err, err_t const& un, err_t const& unp1, value_t a_tol, value_t r_tol )
+    {
+        return ::ponio::detail::reduce_sum( err, local_error_sum( err.array(), un.array(), unp1.array(), a_tol, r_tol ) );
+    }
+#endif
+
     // --- PIROCK REACTION-DIFFUSION ------------------------------------------
 
     /**
@@ -181,14 +273,9 @@ namespace ponio::runge_kutta::pirock
         static constexpr bool is_imex_method     = true;
         static constexpr std::size_t N_operators = 2;
         static constexpr std::size_t N_stages    = stages::dynamic;
-        // clang-format off
-        static constexpr std::size_t N_storage   = std::conditional_t<shampine_trick_enable,
-                                                    std::integral_constant<std::size_t, 18>, // if shampine's trick
-                                                    std::integral_constant<std::size_t, 12>  // else (no error estimation)
-                                                >::value;
-        // clang-format on
-        static constexpr std::size_t order   = 2;
-        static constexpr std::string_view id = "PIROCK";
+        static constexpr std::size_t N_storage   = 11;
+        static constexpr std::size_t order       = 2;
+        static constexpr std::string_view id     = "PIROCK";
 
         using value_t                 = _value_t;
         using rock_coeff              = rock::rock2_coeff<value_t>;
@@ -198,6 +285,7 @@ namespace ponio::runge_kutta::pirock
         alpha_beta_computer_t alpha_beta_computer;
         eig_computer_t eig_computer;
         shampine_trick_caller_t shampine_trick_caller;
+        ::ponio::linear_algebra::solver_cache implicit_solver; // solver on I - \gamma \Delta t F_R kept between two steps
 
         iteration_info<pirock_impl> _info;
 
@@ -265,33 +353,33 @@ namespace ponio::runge_kutta::pirock
                 "This kind of problem is not inversible in ponio" );
 
             // U worker references:
-            // | index | variables        | mathematic representation                         |
-            // |-------|------------------|---------------------------------------------------|
-            // | 0     | u_j              | $u^{(j)}$ current stage in pseudo-ROCK2 method    |
-            // | 0     | fe_tmp_bis       | temporary output of explicit part                 |
-            // | 1     | u_jm1            | $u^{(j-1)}$ previous stage in pseudo-ROCK2 method |
-            // | 1     | fe_tmp_ter       | temporary output of explicit part                 |
-            // | 2     | u_jm2            | $u^{(j-2)}$ previous stage in pseudo-ROCK2 method |
-            // | 2     | fe_tmp_qua       | temporary output of explicit part                 |
-            // | 3     | u_sm2            | $u^{(s-2)}$ stage in PIROCK method                |
-            // | 4     | fe_tmp           | temporary output of explicit part (main output)   |
-            // | 5     | fi_tmp           | temporary output of implicit part (main output)   |
-            // | 6     | f_tmp            | temporary output of implicit part                 |
-            // | 7     | us_sm1           | $u^{\star(s-1)}$ stage in PIROCK method           |
-            // | 8     | us_s             | $u^{\star(s)}$ stage in PIROCK method             |
-            // | 9     | u_sp1            | $u^{(s+1)}$ stage in PIROCK method                |
-            // | 10    | u_sp2            | $u^{(s+2)}$ stage in PIROCK method                |
-            // | 11    | u_sp3            | $u^{(s+3)}$ stage in PIROCK method                |
-            // | 11    | rhs_sp2          | right-hand side to compute $u^{(s+2)}$ stage      |
-            // | 12    | shampine_element | Shampine's trick temporary element                |
-            // | 13    | f_D_u            | $F_D(u^{\star(s-1)}) - F_D(u^{(s-2)})$ term       |
-            // | 14    | u_tmp            | temporary value for compute Shampine's trick      |
-            // | 15    | fe_tmp_bis       | temporary output of explicit part                 |
-            // | 15    | err_D            | $err_D$ error on diffusion term                   |
-            // | 16    | rhs_R            | right-hand side to compute $err_R$ error term     |
-            // | 17    | err_R            | $err_R$ error on reaction term                    |
+            // | index | variables        | mathematic representation                              |
+            // |-------|------------------|--------------------------------------------------------|
+            // | 0     | u_j              | $u^{(j)}$ current stage in pseudo-ROCK2 method         |
+            // | 0     | u_sm2pl          | $u^{(s-2+\ell)}$ stage in PIROCK method                |
+            // | 1     | u_jm1            | $u^{(j-1)}$ previous stage in pseudo-ROCK2 method      |
+            // | 1     | fd_u_sp3         | $F_D(u^{(s+3)})$                                       |
+            // | 1     | f_D_u            | $F_D(u^{(s+3)}) - F_D(u^{(s+1)})$ term                 |
+            // | 2     | u_jm2            | $u^{(j-2)}$ previous stage in pseudo-ROCK2 method      |
+            // | 2     | rhs_sp2          | right-hand side to compute $u^{(s+2)}$ stage           |
+            // | 2     | u_sp3            | $u^{(s+3)}$ stage in PIROCK method                     |
+            // | 2     | err_D            | $err_D$ error on diffusion term                        |
+            // | 3     | fd_u_sm2         | $F_D(u^{(s-2)})$                                       |
+            // | 3     | shampine_element | Shampine's trick temporary element                     |
+            // | 4     | fe_tmp           | temporary output of explicit part (main output)        |
+            // | 4     | fd_u_sp1         | $F_D(u^{(s+1)})$                                       |
+            // | 4     | rhs_R            | right-hand side to compute $err_R$ error term          |
+            // | 5     | fi_tmp           | $F_R(u^{(s+1)})$ (temporary output in Newton method)   |
+            // | 6     | f_tmp            | $F_R(u^{(s+2)})$ (temporary output in Newton method)   |
+            // | 7     | us_sm1           | $u^{\star(s-1)}$ stage in PIROCK method                |
+            // | 7     | us_s             | $u^{\star(s)}$ stage in PIROCK method                  |
+            // | 8     | fd_us_sm1        | $F_D(u^{\star(s-1)})$                                  |
+            // | 8     | u_tmp            | temporary value for compute Shampine's trick           |
+            // | 9     | u_sp1            | $u^{(s+1)}$ stage in PIROCK method                     |
+            // | 10    | u_sp2            | $u^{(s+2)}$ stage in PIROCK method                     |
+            // | 10    | err_R            | $err_R$ error on reaction term                         |
             //
-            // > if method is called as a constant time step method, only index from 0 to 12 are used
+            // > each evaluation of $F_D$ or $F_R$ on a given stage is computed once and kept until its last use
 
             _info.reset_eval();
 
@@ -307,19 +395,32 @@ namespace ponio::runge_kutta::pirock
             std::size_t s = mdeg + 2;
 
             _info.number_of_stages  = s + l + 3;
-            _info.number_of_eval[0] = n_eval + s + l + 4; // explicit evaluation
+            _info.number_of_eval[0] = n_eval + s + l + 1; // explicit evaluation
 
             value_t const alpha = alpha_beta_computer.alpha( s, l );
             value_t const beta  = alpha_beta_computer.beta( s, l );
             value_t const gamma = 1. - 0.5 * std::numbers::sqrt2;
 
-            auto& u_j    = U[0];
-            auto& u_jm1  = U[1];
-            auto& u_jm2  = U[2];
-            auto& u_sm2  = U[3];
-            auto& fe_tmp = U[4];
-            auto& fi_tmp = U[5];
-            auto& f_tmp  = U[6];
+            value_t sigma   = rock_coeff::fp1[deg_index - 1];
+            value_t sigma_a = 0.5 * ( 1.0 - alpha ) + alpha * sigma;
+
+            auto& u_j       = U[0];
+            auto& u_jm1     = U[1];
+            auto& u_jm2     = U[2];
+            auto& fd_u_sm2  = U[3];
+            auto& fe_tmp    = U[4];
+            auto& fi_tmp    = U[5];
+            auto& f_tmp     = U[6];
+            auto& us_sm1    = U[7];
+            auto& fd_us_sm1 = U[8];
+
+            // u_{*s-1} = u_{s-2} + \sigma_\alpha \Delta t  F_D( u_{s-2} ), computed as soon as F_D( u_{s-2} ) is known in Chebyshev loop
+            // (that is in `fe_tmp`), then F_D( u_{s-2} ) is kept for the final stage
+            auto compute_us_sm1 = [&]( state_t const& u_sm2 )
+            {
+                us_sm1 = u_sm2 + sigma_a * dt * fe_tmp;
+                std::swap( fd_u_sm2, fe_tmp );
+            };
 
             u_j   = un;
             u_jm2 = un;
@@ -334,6 +435,11 @@ namespace ponio::runge_kutta::pirock
             pb.explicit_part( tn, un, fe_tmp );
             u_jm1 = un + alpha * dt * mu_1 * fe_tmp;
 
+            if ( s == 2 )
+            {
+                compute_us_sm1( un );
+            }
+
             if ( mdeg < 2 )
             {
                 u_j = u_jm1;
@@ -349,12 +455,13 @@ namespace ponio::runge_kutta::pirock
                 pb.explicit_part( t_jm1, u_jm1, fe_tmp );
                 u_j = alpha * mu_j * dt * fe_tmp - nu_j * u_jm1 - kappa_j * u_jm2;
 
-                t_jm1 = alpha * dt * mu_j - nu_j * t_jm2 - kappa_j * t_jm3;
-
-                if ( j == s - 2 )
+                if ( j - 1 == s - 2 )
                 {
-                    u_sm2 = u_j;
+                    compute_us_sm1( u_jm1 );
                 }
+
+                t_jm1 = alpha * dt * mu_j - nu_j * t_jm2 - kappa_j * t_jm3;
+
                 if ( j < s - 2 + l )
                 {
                     std::swap( u_jm2, u_jm1 );
@@ -374,18 +481,10 @@ namespace ponio::runge_kutta::pirock
             // u_jm1 -> u_{s-2+l-1} = u_{s-1}
             // u_jm2 -> u_{s-2+l-2} = u_{s-2}
 
-            value_t sigma   = rock_coeff::fp1[deg_index - 1];
-            value_t sigma_a = 0.5 * ( 1.0 - alpha ) + alpha * sigma;
-
-            // u_{*s-1} = u_{s-2} + \sigma_\alpha \Delta t  F_D( u_{s-2} )
-            auto& us_sm1 = U[7];
-            pb.explicit_part( t_jm1, u_sm2, fe_tmp );
-            us_sm1 = u_sm2 + sigma_a * dt * fe_tmp;
-
-            // u_{*s} = u_{*s-1} + \sigma_\alpha \Delta t  F_D( u_{*s-1} )
-            auto& us_s = U[8];
-            pb.explicit_part( t_jm1, us_sm1, fe_tmp );
-            us_s = us_sm1 + sigma_a * dt * fe_tmp;
+            // u_{*s} = u_{*s-1} + \sigma_\alpha \Delta t  F_D( u_{*s-1} ), F_D( u_{*s-1} ) is kept for the final stage
+            pb.explicit_part( t_jm1, us_sm1, fd_us_sm1 );
+            us_sm1     = us_sm1 + sigma_a * dt * fd_us_sm1;
+            auto& us_s = us_sm1;
 
             // u_{s-2+l} = u_j
             auto& u_sm2pl = u_j;
@@ -398,21 +497,24 @@ namespace ponio::runge_kutta::pirock
 
             if constexpr ( detail::problem_operator<decltype( pb.implicit_part ), value_t> )
             {
+                using operator_algebra_t = ::ponio::linear_algebra::operator_algebra<state_t>;
+
+                // same operator I - \gamma \Delta t F_R for both implicit stages, kept for next steps if F_R is linear
+                auto& solver_implicit = operator_algebra_t::make_solver( implicit_solver, gamma * dt, pb.implicit_part.f_t( tn ), un );
+
                 std::size_t n_eval_sp1 = 0;
 
-                auto op_sp1  = ::ponio::linear_algebra::operator_algebra<state_t>::identity( un ) - gamma * dt * pb.implicit_part.f_t( tn );
                 auto rhs_sp1 = u_sm2pl;
-                ::ponio::linear_algebra::operator_algebra<state_t>::solve( op_sp1, u_sp1, rhs_sp1, n_eval_sp1 );
+                operator_algebra_t::solve_with( solver_implicit, u_sp1, rhs_sp1, n_eval_sp1 );
 
                 std::size_t n_eval_sp2 = 0;
 
                 pb.explicit_part( tn, u_sp1, fe_tmp );
                 pb.implicit_part( tn, u_sp1, fi_tmp );
-                auto& rhs_sp2 = U[11]; // temporary use of U[10] before u_sp3
+                auto& rhs_sp2 = U[2]; // temporary use of U[2] before u_sp3
 
-                auto op_sp2 = ::ponio::linear_algebra::operator_algebra<state_t>::identity( un ) - gamma * dt * pb.implicit_part.f_t( tn );
-                rhs_sp2     = u_sm2pl + beta * dt * fe_tmp + ( 1. - 2. * gamma ) * dt * fi_tmp;
-                ::ponio::linear_algebra::operator_algebra<state_t>::solve( op_sp2, u_sp2, rhs_sp2, n_eval_sp2 );
+                rhs_sp2 = u_sm2pl + beta * dt * fe_tmp + ( 1. - 2. * gamma ) * dt * fi_tmp;
+                operator_algebra_t::solve_with( solver_implicit, u_sp2, rhs_sp2, n_eval_sp2 );
 
                 _info.number_of_eval[1] += n_eval_sp1 + n_eval_sp2 + 1;
             }
@@ -438,7 +540,6 @@ namespace ponio::runge_kutta::pirock
                     ponio::default_config::newton_tolerance,
                     ponio::default_config::newton_max_iterations );
 
-                _info.number_of_eval[0] += 1;
                 _info.number_of_eval[1] += 1;
                 pb.explicit_part( tn, u_sp1, fe_tmp );
                 pb.implicit_part( tn, u_sp1, fi_tmp );
@@ -458,74 +559,58 @@ namespace ponio::runge_kutta::pirock
                     ponio::default_config::newton_max_iterations );
             }
 
-            _info.number_of_eval[1] += 3;
+            // from here F_D(u^{(s+1)}) and F_R(u^{(s+1)}) are already computed
+            auto& fd_u_sp1 = fe_tmp;
+            auto& fr_u_sp1 = fi_tmp;
 
-            auto& u_sp3 = U[11];
-            pb.implicit_part( tn, u_sp1, fi_tmp );
-            u_sp3 = u_sm2pl + ( 1. - gamma ) * dt * fi_tmp;
+            auto& u_sp3 = U[2];
+            u_sp3       = u_sm2pl + ( 1. - gamma ) * dt * fr_u_sp1;
+
+            auto& fd_u_sp3 = U[1];
+            pb.explicit_part( tn, u_sp3, fd_u_sp3 );
+
+            _info.number_of_eval[1] += 1;
+            auto& fr_u_sp2 = f_tmp;
+            pb.implicit_part( tn, u_sp2, fr_u_sp2 );
 
             value_t tau   = sigma * rock_coeff::fp2[deg_index - 1] + sigma * sigma;
             value_t tau_a = 0.5 * detail::power<2>( alpha - 1. ) + 2. * alpha * ( 1. - alpha ) * sigma + alpha * alpha * tau;
 
-            // auto& u_np1 = U[12];
-
-            if constexpr ( shampine_trick_enable && detail::problem_operator<decltype( pb.implicit_part ), value_t> )
+            if constexpr ( shampine_trick_enable )
             {
-                auto& shampine_element = U[12];
-                auto& f_D_u            = U[13];
-                auto& u_tmp            = U[14];
-                auto& fe_tmp_bis       = U[14]; // temporary use of U[15] before u_tmp
+                // J_R = \partial_u F_R(u^{(s-2+\ell)}), the same for all calls to Shampine's trick in this step
+                auto J_R = reaction_linear_part( pb.implicit_part, tn, u_sm2pl );
 
                 // for embedded method
-                auto& err_D = U[15];
+                auto& err_D = U[2]; // u_sp3 is no longer needed
 
                 // $err_D = \sigma_\alpha(1-\tau_a/\sigma_a^2)\Delta t (F_D(u^{*(s-1)}) - F_D(u^{(s-2)}))$
-                pb.explicit_part( tn, us_sm1, fe_tmp );
-                pb.explicit_part( tn, u_sm2, fe_tmp_bis );
-                err_D = sigma_a * ( 1. - tau_a / ( sigma_a * sigma_a ) ) * dt * ( fe_tmp - fe_tmp_bis );
+                err_D = sigma_a * ( 1. - tau_a / ( sigma_a * sigma_a ) ) * dt * ( fd_us_sm1 - fd_u_sm2 );
 
-                pb.explicit_part( tn, u_sp3, fe_tmp );
-                pb.explicit_part( tn, u_sp1, fe_tmp_bis );
-                f_D_u = static_cast<state_t>( fe_tmp - fe_tmp_bis );
+                auto& f_D_u = fd_u_sp3;
+                f_D_u       = static_cast<state_t>( fd_u_sp3 - fd_u_sp1 );
 
-                shampine_trick_caller.template operator()<l>( gamma * dt, pb.implicit_part.f_t( tn ), u_sm2pl, f_D_u, u_tmp, shampine_element );
+                auto& shampine_element = U[3]; // F_D(u^{(s-2)}) is no longer needed
+                auto& u_tmp            = U[8]; // F_D(u^{*(s-1)}) is no longer needed
+
+                shampine_trick_caller.template operator()<l>( gamma * dt, J_R, u_sm2pl, f_D_u, u_tmp, shampine_element );
 
                 if constexpr ( is_embedded )
                 {
-                    auto& rhs_R = U[16];
-                    auto& err_R = U[17];
+                    auto& rhs_R = U[4];  // F_D(u^{(s+1)}) is no longer needed
+                    auto& err_R = U[10]; // u^{(s+2)} is no longer needed
 
-                    _info.number_of_eval[1] += 2;
-
-                    pb.implicit_part( tn, u_sp1, fi_tmp );
-                    pb.implicit_part( tn, u_sp2, f_tmp );
-                    rhs_R = static_cast<state_t>( dt / 6. * ( fi_tmp - f_tmp ) );
+                    rhs_R = static_cast<state_t>( dt / 6. * ( fr_u_sp1 - fr_u_sp2 ) );
 
                     // $err_R = J_R^{-1} \Delta t/6 (F_R(u^{s+1}) - F_R(u^{s+2}))$
                     // to compute it, get $rhs_R = \Delta t/6 (F_R(u^{s+1}) - F_R(u^{s+2}))$
                     // then solve $J_R err_R = rhs_R$ (that what Shampine's trick does, it build $J_R$ and solve it)
-                    shampine_trick_caller.template operator()<1>( gamma * dt, pb.implicit_part.f_t( tn ), u_sm2pl, rhs_R, u_tmp, err_R );
+                    shampine_trick_caller.template operator()<1>( gamma * dt, J_R, u_sm2pl, rhs_R, u_tmp, err_R );
 
-                    u_np1 = us_s - err_D + 0.5 * dt * fi_tmp + 0.5 * dt * f_tmp + dt / ( 2. - 4. * gamma ) * shampine_element;
+                    u_np1 = us_s - err_D + 0.5 * dt * fr_u_sp1 + 0.5 * dt * fr_u_sp2 + dt / ( 2. - 4. * gamma ) * shampine_element;
 
-                    auto accumulator_error_gen = []( auto const& yn, auto const& ynp1, value_t a_tol, value_t r_tol )
-                    {
-                        return [=, it_yn = yn.begin(), it_ynp1 = ynp1.begin()]( value_t const& acc, value_t const err_i ) mutable
-                        {
-                            using namespace std;
-                            return acc + detail::power<2>( err_i / ( a_tol + r_tol * max( abs( *it_yn++ ), abs( *it_ynp1++ ) ) ) );
-                        };
-                    };
-
-                    // TODO: this couple of lines works only with samurai (because of err_D.array())
-                    value_t err_R_scalar = std::accumulate( err_R.array().begin(),
-                        err_R.array().end(),
-                        static_cast<value_t>( 0. ),
-                        accumulator_error_gen( un.array(), u_np1.array(), _info.absolute_tolerance, _info.relative_tolerance ) );
-                    value_t err_D_scalar = std::accumulate( err_D.array().begin(),
-                        err_D.array().end(),
-                        static_cast<value_t>( 0. ),
-                        accumulator_error_gen( un.array(), u_np1.array(), _info.absolute_tolerance, _info.relative_tolerance ) );
+                    value_t err_R_scalar = error_sum( err_R, un, u_np1, _info.absolute_tolerance, _info.relative_tolerance );
+                    value_t err_D_scalar = error_sum( err_D, un, u_np1, _info.absolute_tolerance, _info.relative_tolerance );
 
                     _info.error   = std::max( err_D_scalar, err_R_scalar );
                     _info.success = _info.error < 1.0;
@@ -556,30 +641,15 @@ namespace ponio::runge_kutta::pirock
                 }
                 else
                 {
-                    pb.implicit_part( tn, u_sp1, fi_tmp );
-                    pb.implicit_part( tn, u_sp2, f_tmp );
-
                     tn    = tn + dt;
-                    u_np1 = us_s - err_D + 0.5 * dt * fi_tmp + 0.5 * dt * f_tmp + dt / ( 2. - 4. * gamma ) * shampine_element;
+                    u_np1 = us_s - err_D + 0.5 * dt * fr_u_sp1 + 0.5 * dt * fr_u_sp2 + dt / ( 2. - 4. * gamma ) * shampine_element;
                 }
             }
             else
             {
-                auto& fe_tmp_bis = U[0]; // temporary use of U[0] after u_j
-                auto& fe_tmp_ter = U[1]; // temporary use of U[1] after u_jm1
-                auto& fe_tmp_qua = U[2]; // temporary use of U[2] after u_jm2
-
-                pb.explicit_part( tn, us_sm1, fe_tmp );
-                pb.explicit_part( tn, u_sm2, fe_tmp_bis );
-                pb.explicit_part( tn, u_sp3, fe_tmp_ter );
-                pb.explicit_part( tn, u_sp1, fe_tmp_qua );
-
-                pb.implicit_part( tn, u_sp1, fi_tmp );
-                pb.implicit_part( tn, u_sp2, f_tmp );
-
                 tn    = tn + dt;
-                u_np1 = us_s - sigma_a * ( 1. - tau_a / ( sigma_a * sigma_a ) ) * dt * ( fe_tmp - fe_tmp_bis ) + 0.5 * dt * fi_tmp
-                      + 0.5 * dt * f_tmp + dt / ( 2. - 4. * gamma ) * ( fe_tmp_ter - fe_tmp_qua );
+                u_np1 = us_s - sigma_a * ( 1. - tau_a / ( sigma_a * sigma_a ) ) * dt * ( fd_us_sm1 - fd_u_sm2 ) + 0.5 * dt * fr_u_sp1
+                      + 0.5 * dt * fr_u_sp2 + dt / ( 2. - 4. * gamma ) * ( fd_u_sp3 - fd_u_sp1 );
             }
 
             // return { tn + dt, u_np1, dt };
@@ -822,6 +892,7 @@ namespace ponio::runge_kutta::pirock
         alpha_beta_computer_t alpha_beta_computer;
         eig_computer_t eig_computer;
         shampine_trick_caller_t shampine_trick_caller;
+        ::ponio::linear_algebra::solver_cache implicit_solver; // solver on I - \gamma \Delta t F_R kept between two steps
 
         iteration_info<pirock_RDA_impl> _info;
 
@@ -1010,15 +1081,20 @@ namespace ponio::runge_kutta::pirock
 
             if constexpr ( detail::problem_operator<std::tuple_element_t<reaction_op::value, decltype( pb.system )>, value_t> )
             {
+                using operator_algebra_t = ::ponio::linear_algebra::operator_algebra<state_t>;
+
+                // I - \gamma \Delta t F_R, same operator for both implicit stages, kept for next steps if F_R is linear
+                auto& solver_implicit = operator_algebra_t::make_solver( implicit_solver,
+                    gamma * dt,
+                    std::get<reaction_op::value>( pb.system ).f_t( tn ),
+                    un );
+
                 std::size_t n_eval_sp1 = 0;
 
-                // I - \gamma \Delta t F_R
-                auto op_sp1 = ::ponio::linear_algebra::operator_algebra<state_t>::identity( un )
-                            - gamma * dt * std::get<reaction_op::value>( pb.system ).f_t( tn );
                 // u^{(s-2+\ell)}
                 auto rhs_sp1 = u_sm2pl;
 
-                ::ponio::linear_algebra::operator_algebra<state_t>::solve( op_sp1, u_sp1, rhs_sp1, n_eval_sp1 );
+                operator_algebra_t::solve_with( solver_implicit, u_sp1, rhs_sp1, n_eval_sp1 );
 
                 pb( advection_op(), tn, u_sp1, Fa_u_sp1 );
 
@@ -1026,13 +1102,10 @@ namespace ponio::runge_kutta::pirock
 
                 pb( diffusion_op(), tn, u_sp1, fd_tmp );
                 pb( reaction_op(), tn, u_sp1, fr_tmp );
-                // I - \gamma \Delta t F_R
-                auto op_sp2 = ::ponio::linear_algebra::operator_algebra<state_t>::identity( un )
-                            - gamma * dt * std::get<reaction_op::value>( pb.system ).f_t( tn );
                 // u^{(s-2+\ell)} + \beta \Delta t F_D(u^{(s+1)}) + \Delta t F_A(u^{(s+1)}) + (1-2\gamma)\Delta t F_R(u^{(s+1)})
                 auto rhs_sp2 = static_cast<state_t>( u_sm2pl + beta * dt * fd_tmp + dt * Fa_u_sp1 + ( 1. - 2. * gamma ) * dt * fr_tmp );
 
-                ::ponio::linear_algebra::operator_algebra<state_t>::solve( op_sp2, u_sp2, rhs_sp2, n_eval_sp2 );
+                operator_algebra_t::solve_with( solver_implicit, u_sp2, rhs_sp2, n_eval_sp2 );
 
                 _info.number_of_eval[1] += n_eval_sp1 + n_eval_sp2 + 1;
             }
@@ -1102,9 +1175,11 @@ namespace ponio::runge_kutta::pirock
 
             auto& u_sp5 = U[19];
 
-            if constexpr ( shampine_trick_enable
-                           && detail::problem_operator<std::tuple_element_t<reaction_op::value, decltype( pb.system )>, value_t> )
+            if constexpr ( shampine_trick_enable )
             {
+                // J_R = \partial_u F_R(u^{(s-2+\ell)})
+                auto J_R = reaction_linear_part( std::get<reaction_op::value>( pb.system ), tn, u_sm2pl );
+
                 auto& shampine_element = U[21]; // solution of (I - \gamma \Delta t \partial_u F_R ) X = F_A(u^{(s+4)})
                 auto& f_A_u            = U[22];
                 auto& u_tmp            = U[23];
@@ -1112,16 +1187,10 @@ namespace ponio::runge_kutta::pirock
                 pb( advection_op(), tn, u_sp4, f_A_u );
                 f_A_u = dt * f_A_u;
 
-                shampine_trick_caller.template operator()<1>( gamma * dt,
-                    std::get<reaction_op::value>( pb.system ).f_t( tn ),
-                    u_sm2pl,
-                    f_A_u,
-                    u_tmp,
-                    shampine_element );
+                shampine_trick_caller.template operator()<1>( gamma * dt, J_R, u_sm2pl, f_A_u, u_tmp, shampine_element );
 
-                pb( diffusion_op(), tn, u_sp1, fd_tmp );
-                pb( reaction_op(), tn, u_sp1, fr_tmp );
-                pb( reaction_op(), u_sp2, fr_tmp_bis );
+                // fd_tmp and fr_tmp still hold F_D(u^{(s+1)}) and F_R(u^{(s+1)})
+                pb( reaction_op(), tn, u_sp2, fr_tmp_bis );
                 u_sp5 = u_sm2pl + 2. / 3. * beta * dt * fd_tmp + 2. / 3. * shampine_element + ( 2. / 3. - gamma ) * dt * fr_tmp
                       + 2. / 3. * gamma * dt * fr_tmp_bis;
             }
@@ -1138,9 +1207,11 @@ namespace ponio::runge_kutta::pirock
             value_t tau   = sigma * rock_coeff::fp2[deg_index - 1] + sigma * sigma;
             value_t tau_a = 0.5 * detail::power<2>( alpha - 1. ) + 2. * alpha * ( 1. - alpha ) * sigma + alpha * alpha * tau;
 
-            if constexpr ( shampine_trick_enable
-                           && detail::problem_operator<std::tuple_element_t<reaction_op::value, decltype( pb.system )>, value_t> )
+            if constexpr ( shampine_trick_enable )
             {
+                // J_R = \partial_u F_R(u^{(s-2+\ell)})
+                auto J_R = reaction_linear_part( std::get<reaction_op::value>( pb.system ), tn, u_sm2pl );
+
                 auto& shampine_element = U[20];
                 auto& f_D_u            = U[21];
                 auto& u_tmp            = U[22];
@@ -1156,12 +1227,7 @@ namespace ponio::runge_kutta::pirock
                 pb( diffusion_op(), tn, u_sp1, fd_tmp_bis );
                 f_D_u = static_cast<state_t>( fd_tmp - fd_tmp_bis );
 
-                shampine_trick_caller.template operator()<l>( gamma * dt,
-                    std::get<reaction_op::value>( pb.system ).f_t( tn ),
-                    u_sm2pl,
-                    f_D_u,
-                    u_tmp,
-                    shampine_element );
+                shampine_trick_caller.template operator()<l>( gamma * dt, J_R, u_sm2pl, f_D_u, u_tmp, shampine_element );
 
                 if constexpr ( is_embedded )
                 {
@@ -1178,12 +1244,7 @@ namespace ponio::runge_kutta::pirock
                     // $err_R = J_R^{-1} \Delta t/6 (F_R(u^{s+1}) - F_R(u^{s+2}))$
                     // to compute it, get $rhs_R = \Delta t/6 (F_R(u^{s+1}) - F_R(u^{s+2}))$
                     // then solve $J_R err_R = rhs_R$ (that what Shampine's trick does, it build $J_R$ and solve it)
-                    shampine_trick_caller.template operator()<1>( gamma * dt,
-                        std::get<reaction_op::value>( pb.system ).f_t( tn ),
-                        u_sm2pl,
-                        rhs_R,
-                        u_tmp,
-                        err_R );
+                    shampine_trick_caller.template operator()<1>( gamma * dt, J_R, u_sm2pl, rhs_R, u_tmp, err_R );
 
                     pb( advection_op(), tn, u_sp4, fa_tmp );
                     pb( advection_op(), tn, u_sp5, fa_tmp_bis );
@@ -1193,30 +1254,11 @@ namespace ponio::runge_kutta::pirock
                     u_np1 = us_s - err_D + 0.5 * dt * fr_tmp + 0.25 * dt * Fa_u_sp1 + 0.75 * dt * fa_tmp_bis + 0.5 * dt * fr_tmp
                           + 0.5 * dt * fr_tmp_bis + 1.0 / ( 2. - 4. * gamma ) * shampine_element;
 
-                    auto accumulator_error_gen = []( auto const& yn, auto const& ynp1, value_t a_tol, value_t r_tol )
-                    {
-                        return [=, it_yn = yn.begin(), it_ynp1 = ynp1.begin()]( value_t const& acc, value_t const err_i ) mutable
-                        {
-                            using namespace std;
-                            return acc + detail::power<2>( err_i / ( a_tol + r_tol * max( abs( *it_yn++ ), abs( *it_ynp1++ ) ) ) );
-                        };
-                    };
-
-                    // TODO: this couple of lines works only with samurai (because of err_D.array())
-                    value_t err_R_scalar = std::accumulate( err_R.array().begin(),
-                        err_R.array().end(),
-                        static_cast<value_t>( 0. ),
-                        accumulator_error_gen( un.array(), u_np1.array(), _info.absolute_tolerance, _info.relative_tolerance ) );
-                    value_t err_D_scalar = std::accumulate( err_D.array().begin(),
-                        err_D.array().end(),
-                        static_cast<value_t>( 0. ),
-                        accumulator_error_gen( un.array(), u_np1.array(), _info.absolute_tolerance, _info.relative_tolerance ) );
-                    value_t err_A_scalar = std::accumulate( err_A.array().begin(),
-                        err_A.array().end(),
-                        static_cast<value_t>( 0. ),
-                        accumulator_error_gen( un.array(), u_np1.array(), _info.absolute_tolerance, _info.relative_tolerance ) );
-
-                    _info.error   = std::max( err_D_scalar, err_R_scalar, std::pow( err_A_scalar, 2. / 3. ) );
+                    value_t err_R_scalar = error_sum( err_R, un, u_np1, _info.absolute_tolerance, _info.relative_tolerance );
+                    value_t err_D_scalar = error_sum( err_D, un, u_np1, _info.absolute_tolerance, _info.relative_tolerance );
+                    value_t err_A_scalar = error_sum( err_A, un, u_np1, _info.absolute_tolerance, _info.relative_tolerance );
+
+                    _info.error   = std::max( { err_D_scalar, err_R_scalar, std::pow( err_A_scalar, 2. / 3. ) } );
                     _info.success = _info.error < 1.0;
 
                     value_t fac    = std::min( 2.0, std::max( 0.5, std::sqrt( 1.0 / _info.error ) ) );
@@ -6,8 +6,10 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <string_view> // NOLINT(misc-include-cleaner)
+#include <utility>
 
 #include "../detail.hpp" // NOLINT(misc-include-cleaner)
 #include "../iteration_info.hpp"
@@ -17,7 +19,7 @@ namespace ponio::runge_kutta::chebyshev
 {
 
     /**
-     * @brief Chebyshev polynomial of first kind by recursive method: \f$$\begin{aligned}T_0(x) &= 1\\ T_1(x) &= x\\ T_{n+1}(x) &=
+     * @brief Chebyshev polynomial of first kind by three-term recurrence: \f$$\begin{aligned}T_0(x) &= 1\\ T_1(x) &= x\\ T_{n+1}(x) &=
      * 2xT_n(x) - T_{n-1}(x)\end{aligned}}\f$$
      *
      * @tparam N degree of polynomial
@@ -28,22 +30,27 @@ namespace ponio::runge_kutta::chebyshev
     value_t
     T( value_t const x )
     {
+        value_t t_jm1 = static_cast<value_t>( 1. );
+        value_t t_j   = x;
+
         if constexpr ( N == 0 )
         {
-            return static_cast<value_t>( 1. );
-        }
-        else if constexpr ( N == 1 )
-        {
-            return x;
+            return t_jm1;
         }
-        else
+
+        for ( std::size_t j = 1; j < N; ++j )
         {
-            return 2 * x * T<N - 1>( x ) - T<N - 2>( x );
+            value_t const t_jp1 = 2 * x * t_j - t_jm1;
+
+            t_jm1 = t_j;
+            t_j   = t_jp1;
         }
+
+        return t_j;
     }
 
     /**
-     * @brief Chebyshev polynomial of second kind by recursive method: \f$$\begin{aligned}U_0(x) &= 1\\ U_1(x) &= 2x\\ U_{n+1}(x) &=
+     * @brief Chebyshev polynomial of second kind by three-term recurrence: \f$$\begin{aligned}U_0(x) &= 1\\ U_1(x) &= 2x\\ U_{n+1}(x) &=
      * 2xU_n(x) - U_{n-1}(x)\end{aligned}}\f$$
      *
      * @tparam N degree of polynomial
@@ -54,18 +61,23 @@ namespace ponio::runge_kutta::chebyshev
     value_t
     U( value_t const x )
     {
+        value_t u_jm1 = static_cast<value_t>( 1. );
+        value_t u_j   = 2 * x;
+
         if constexpr ( N == 0 )
         {
-            return static_cast<value_t>( 1. );
+            return u_jm1;
         }
-        else if constexpr ( N == 1 )
-        {
-            return 2 * x;
-        }
-        else
+
+        for ( std::size_t j = 1; j < N; ++j )
         {
-            return 2 * x * U<N - 1>( x ) - U<N - 2>( x );
+            value_t const u_jp1 = 2 * x * u_j - u_jm1;
+
+            u_jm1 = u_j;
+            u_j   = u_jp1;
         }
+
+        return u_j;
     }
 
     /**
@@ -116,161 +128,128 @@ namespace ponio::runge_kutta::chebyshev
      *
      *  @tparam N_stages_ number of stages
      *  @tparam value_t type of coefficients
+     *
+     *  @details the three-term recurrence is computed in place, so the method only stores 4 states whatever the number of stages
      */
     template <std::size_t N_stages_, typename _value_t = double>
     struct explicit_rkc2
     {
         static_assert( N_stages_ > 1, "Number of stages should be at least 2 in eRKC2" );
-        static constexpr std::size_t N_stages = N_stages_;
-        static constexpr std::size_t order    = 2;
-        static constexpr std::string_view id  = "RKC2";
-        static constexpr bool is_embedded     = false;
-        using value_t                         = _value_t;
+        static constexpr std::size_t N_stages  = stages::dynamic;
+        static constexpr std::size_t N_storage = 4;
+        static constexpr std::size_t order     = 2;
+        static constexpr std::string_view id   = "RKC2";
+        static constexpr bool is_embedded      = false;
+        using value_t                          = _value_t;
 
         value_t w0;
         value_t w1;
+        std::array<value_t, N_stages_ + 1> mu;
+        std::array<value_t, N_stages_ + 1> nu;
+        std::array<value_t, N_stages_ + 1> mu_t;
+        std::array<value_t, N_stages_ + 1> gamma_t;
+        std::array<value_t, N_stages_ + 1> c;
         iteration_info<explicit_rkc2> _info;
 
         /**
-         * @brief computes \f$b_j = \f$ coefficients with following formula: \f$b_0=b_2\f$, \f$b_1=\frac{1}{\omega_0}\f$, \f$b_j =
-         * \frac{T_j''(\omega_0)}{(T_j'(\omega_0))^2}\f$
+         * @brief Construct a new explicit RKC2 algorithm
          *
-         * @tparam J index \f$j\f$
-         * @param x  value of \f$\omega_0\f$
+         * @param eps value of relaxation
+         *
+         * @details all coefficients \f$\mu_j\f$, \f$\nu_j\f$, \f$\tilde{\mu}_j\f$, \f$\tilde{\gamma}_j\f$ and \f$c_j\f$ are computed once
+         * here, with three-term recurrences on \f$T_j(\omega_0)\f$, \f$T_j'(\omega_0)\f$ and \f$T_j''(\omega_0)\f$, and
+         * \f$b_j = \frac{T_j''(\omega_0)}{(T_j'(\omega_0))^2}\f$ for \f$j\geq 2\f$, \f$b_0=b_1=b_2\f$.
          */
-        template <std::size_t J>
-        static constexpr value_t
-        b( value_t const x )
+        explicit_rkc2( value_t eps = 2. / 13. )
+            : w0( 1. + eps / ( N_stages_ * N_stages_ ) )
+            , w1( 0. )
+            , mu()
+            , nu()
+            , mu_t()
+            , gamma_t()
+            , c()
+            , _info()
         {
-            if constexpr ( J == 0 || J == 1 )
+            std::array<value_t, N_stages_ + 1> Tj;
+            std::array<value_t, N_stages_ + 1> dTj;
+            std::array<value_t, N_stages_ + 1> ddTj;
+            std::array<value_t, N_stages_ + 1> bj;
+
+            Tj[0]   = 1.;
+            Tj[1]   = w0;
+            dTj[0]  = 0.;
+            dTj[1]  = 1.;
+            ddTj[0] = 0.;
+            ddTj[1] = 0.;
+            for ( std::size_t j = 2; j <= N_stages_; ++j )
             {
-                return b<2>( x );
+                Tj[j]   = 2. * w0 * Tj[j - 1] - Tj[j - 2];
+                dTj[j]  = 2. * Tj[j - 1] + 2. * w0 * dTj[j - 1] - dTj[j - 2];
+                ddTj[j] = 4. * dTj[j - 1] + 2. * w0 * ddTj[j - 1] - ddTj[j - 2];
+                bj[j]   = ddTj[j] / detail::power<2>( dTj[j] );
             }
-            else
+            bj[0] = bj[2];
+            bj[1] = bj[2];
+
+            w1 = dTj[N_stages_] / ddTj[N_stages_];
+
+            for ( std::size_t j = 2; j <= N_stages_; ++j )
             {
-                return ddT<J>( x ) / ( detail::power<2>( dT<J>( x ) ) );
+                mu[j]      = 2. * bj[j] / bj[j - 1] * w0;
+                nu[j]      = -bj[j] / bj[j - 2];
+                mu_t[j]    = 2. * bj[j] / bj[j - 1] * w1;
+                gamma_t[j] = -( 1. - bj[j - 1] * Tj[j - 1] ) * mu_t[j];
+                c[j]       = w1 * ddTj[j] / dTj[j];
             }
-        }
+            mu_t[1] = bj[1] * w1;
+            c[1]    = c[2] / dTj[2];
 
-        /**
-         * @brief Construct a new explicit RKC2 algorithm
-         *
-         * @param eps value of relaxation
-         */
-        explicit_rkc2( value_t eps = 2. / 13. )
-            : w0( 1. + eps / ( N_stages * N_stages ) )
-            , w1( dT<N_stages>( w0 ) / ddT<N_stages>( w0 ) )
-            , _info()
-        {
-            _info.number_of_eval = N_stages;
+            _info.number_of_stages = N_stages_;
+            _info.number_of_eval   = N_stages_;
         }
 
         /**
-         * @brief computes stage \f$j\f$ of RKC2 method
+         * @brief iteration of RKC2 method
          *
          * @tparam problem_t  type of operator \f$f\f$
          * @tparam state_t    type of current state
-         * @tparam array_ki_t type of array of temporary stages
-         * @tparam j          integer of stage
-         * @param f  operator \f$f\f$
-         * @param tn current time
-         * @param yn current state
-         * @param Yj array of temporary stages
-         * @param dt current time step
-         * @param ui temporary step
-         * @param yi computed output step
+         * @tparam array_ki_t type of temporary stages (only 4 needed for RKC2)
+         * @param f    operator \f$f\f$
+         * @param tn   current time
+         * @param yn   current state
+         * @param G    array of temporary stages
+         * @param dt   current time step
+         * @param ynp1 solution \f$y^{n+1}\f$ at time \f$t^{n+1} = t^n + \Delta t\f$
          *
          * @details \f$y_j = (1 - \mu_j - \nu_j)y^n + \mu_j y_{j-1} + \nu_j y_{j-2} + \tilde{\mu}_j\Delta tf(t^n + c_{j-1}\Delta t, y_{j-1})
-         * + \tilde{\gamma}_j\Delta t f(t^n, y^n)\f$
-         */
-        template <typename problem_t, typename state_t, typename array_ki_t, std::size_t j>
-        void
-        stage( Stage<j>, problem_t& f, value_t tn, state_t& yn, array_ki_t const& Yj, value_t dt, state_t& ui, state_t& yi )
-        {
-            value_t const mj   = 2. * b<j>( w0 ) / b<j - 1>( w0 ) * w0;
-            value_t const nj   = -b<j>( w0 ) / b<j - 2>( w0 );
-            value_t const mjt  = 2. * b<j>( w0 ) / b<j - 1>( w0 ) * w1;
-            value_t const gjt  = -( 1. - b<j - 1>( w0 ) * T<j - 1>( w0 ) ) * mjt;
-            value_t const cjm1 = dT<N_stages>( w0 ) / ddT<N_stages>( w0 ) * ddT<j - 1>( w0 ) / dT<j - 1>( w0 );
-
-            f( tn + cjm1 * dt, Yj[j - 1], ui ); // first compute ui = f(t^n + c_{j-1}\Delta t, y_{j-1})
-            yi = ( 1. - mj - nj ) * yn + mj * Yj[j - 1] + nj * Yj[j - 2] + mjt * dt * ui + gjt * dt * Yj[0];
-        }
-
-        /**
-         * @brief computes pseudo first stage of RKC2 method
-         *
-         * @tparam problem_t  type of operator \f$f\f$
-         * @tparam state_t    type of current state
-         * @tparam array_ki_t type of array of temporary stages
-         * @tparam j          integer of stage
-         * @param f  operator \f$f\f$
-         * @param tn current time
-         * @param yn current state
-         * @param yi computed output step
-         *
-         * @details \f$y_0 = f(t^n, y^n)\f$
+         * + \tilde{\gamma}_j\Delta t f(t^n, y^n)\f$, with \f$y_0 = y^n\f$ and \f$y_1 = y^n + \tilde{\mu}_1 \Delta t f(t^n, y^n)\f$
          */
         template <typename problem_t, typename state_t, typename array_ki_t>
         void
-        stage( Stage<0>, problem_t& f, value_t tn, state_t& yn, array_ki_t const&, value_t, state_t&, state_t& yi )
+        operator()( problem_t& f, value_t& tn, state_t& yn, array_ki_t& G, value_t& dt, state_t& ynp1 )
         {
-            f( tn, yn, yi ); // be careful Yj[0] stores f(tn,yn) not yn!!!
-        }
+            auto& f0    = G[0];
+            auto& yjm1  = G[1];
+            auto& yjm2  = G[2];
+            auto& f_tmp = G[3];
 
-        /**
-         * @brief computes first stage of RKC2 method
-         *
-         * @tparam problem_t  type of operator \f$f\f$
-         * @tparam state_t    type of current state
-         * @tparam array_ki_t type of array of temporary stages
-         * @tparam j          integer of stage
-         * @param yn current state
-         * @param Yj array of temporary stages
-         * @param dt current time step
-         * @param yi computed output step
-         *
-         * @details \f$y_1 = y^n + \tilde{\mu}_1 \Delta t f(t^n, y^n)\f$
-         */
-        template <typename problem_t, typename state_t, typename array_ki_t>
-        void
-        stage( Stage<1>, problem_t&, value_t, state_t& yn, array_ki_t const& Yj, value_t dt, state_t&, state_t& yi )
-        {
-            value_t const m1t = b<1>( w0 ) * w1;
-            yi                = yn + dt * m1t * Yj[0];
-        }
+            f( tn, yn, f0 );
+            yjm1 = yn + dt * mu_t[1] * f0;
 
-        /**
-         * @brief computes second stage of RKC2 method
-         *
-         * @tparam problem_t  type of operator \f$f\f$
-         * @tparam state_t    type of current state
-         * @tparam array_ki_t type of array of temporary stages
-         * @tparam j          integer of stage
-         * @param f  operator \f$f\f$
-         * @param tn current time
-         * @param yn current state
-         * @param Yj array of temporary stages
-         * @param dt current time step
-         * @param ui temporary step
-         * @param yi computed output step
-         *
-         * @details \f$y_2 = (1-\mu_2 -\nu_2)y^n + \mu_2y_1 + \nu_2y^n + \tilde{\mu}_2\Delta t f(t^n + c_1\Delta t, y_1) + \tilde{\gamma}_2
-         * \Delta t f(t^n, y^n)\f$
-         */
-        template <typename problem_t, typename state_t, typename array_ki_t>
-        void
-        stage( Stage<2>, problem_t& f, value_t tn, state_t& yn, array_ki_t const& Yj, value_t dt, state_t& ui, state_t& yi )
-        {
-            value_t const m2  = 2. * w0;
-            value_t const n2  = -1.;
-            value_t const m2t = 2. * w1;
-            value_t const c2  = dT<N_stages>( w0 ) / ddT<N_stages>( w0 ) * ddT<2>( w0 ) / dT<2>( w0 );
-            value_t const c1  = c2 / dT<2>( w0 );
-            value_t const g2t = -( 1. - b<1>( w0 ) * T<1>( w0 ) ) * m2t;
-
-            f( tn + c1 * dt, Yj[1], ui ); // first compute yi = f(t^n + c_1\Delta t, y_1)
-            yi = ( 1. - m2 - n2 ) * yn + m2 * Yj[1] + n2 * yn + m2t * dt * ui + g2t * dt * Yj[0];
+            // y_2 computed from y_0 = y^n
+            f( tn + c[1] * dt, yjm1, f_tmp );
+            yjm2 = ( 1. - mu[2] - nu[2] ) * yn + mu[2] * yjm1 + nu[2] * yn + mu_t[2] * dt * f_tmp + gamma_t[2] * dt * f0;
+            std::swap( yjm1, yjm2 );
+
+            for ( std::size_t j = 3; j <= N_stages_; ++j )
+            {
+                f( tn + c[j - 1] * dt, yjm1, f_tmp );
+                yjm2 = ( 1. - mu[j] - nu[j] ) * yn + mu[j] * yjm1 + nu[j] * yjm2 + mu_t[j] * dt * f_tmp + gamma_t[j] * dt * f0;
+                std::swap( yjm1, yjm2 );
+            }
+
+            tn = tn + dt;
+            std::swap( yjm1, ynp1 );
         }
 
         /**
@@ -8,6 +8,7 @@
 
 #include <cstddef>
 #include <string_view> // NOLINT(misc-include-cleaner)
+#include <utility>
 
 #include "../iteration_info.hpp"
 #include "../stage.hpp" // NOLINT(misc-include-cleaner)
@@ -22,27 +23,29 @@ namespace ponio::runge_kutta::legendre
      * @tparam _value_t type of coefficients
      *
      * @warning the method is only presented with an autonomous problem, ie \f$\dot{y} = f(y)\f$
+     *
+     * @details the three-term recurrence is computed in place, so the method only stores 3 states whatever the number of stages
      */
     template <std::size_t N_stages_, typename _value_t = double>
     struct explicit_rkl1
     {
         static_assert( N_stages_ > 0, "Number of stages should be at least 1 in eRKL1" );
-        static constexpr std::size_t N_stages = N_stages_;
-        static constexpr std::size_t order    = 1;
-        static constexpr std::string_view id  = "RKL1";
-        static constexpr bool is_embedded     = false;
-        using value_t                         = _value_t;
+        static constexpr std::size_t N_stages  = stages::dynamic;
+        static constexpr std::size_t N_storage = 3;
+        static constexpr std::size_t order     = 1;
+        static constexpr std::string_view id   = "RKL1";
+        static constexpr bool is_embedded      = false;
+        using value_t                          = _value_t;
 
         iteration_info<explicit_rkl1> _info;
 
         /**
          * @brief compute \f$\mu_j = \frac{2j-1}{j}\f$
          *
-         * @tparam j index \f$j\f$
+         * @param j index \f$j\f$
          */
-        template <std::size_t j>
         static constexpr value_t
-        mu()
+        mu( std::size_t j )
         {
             return static_cast<value_t>( 2 * j - 1 ) / static_cast<value_t>( j );
         }
@@ -50,11 +53,10 @@ namespace ponio::runge_kutta::legendre
         /**
          * @brief compute \f$\nu_j = \frac{1-j}{j}\f$
          *
-         * @tparam j index \f$j\f$
+         * @param j index \f$j\f$
          */
-        template <std::size_t j>
         static constexpr value_t
-        nu()
+        nu( std::size_t j )
         {
             return ( 1 - static_cast<value_t>( j ) ) / static_cast<value_t>( j );
         }
@@ -62,84 +64,65 @@ namespace ponio::runge_kutta::legendre
         /**
          * @brief compute \f$\tilde{\mu}_j = \frac{2j-1}{j}\frac{2}{s^2 + s}\f$ with \f$s\f$ the number of stages
          *
-         * @tparam j index \f$j\f$
+         * @param j index \f$j\f$
          */
-        template <std::size_t j>
         static constexpr value_t
-        mu_t()
+        mu_t( std::size_t j )
         {
             return static_cast<value_t>( 2 * j - 1 ) / static_cast<value_t>( j ) * 2.
-                 / static_cast<value_t>( N_stages * N_stages + N_stages );
+                 / static_cast<value_t>( N_stages_ * N_stages_ + N_stages_ );
         }
 
         explicit_rkl1()
         {
-            _info.number_of_eval = N_stages;
-        }
-
-        /**
-         * @brief compute stage \f$j\f$ of RKL1 method
-         *
-         * @tparam problem_t  type of operator \f$f\f$
-         * @tparam state_t    type of current state
-         * @tparam array_ki_t type of array of temporary stages
-         * @tparam j          integer of stage
-         * @param f  operator \f$f\f$
-         * @param tn current time
-         * @param Yj array of temporary stages
-         * @param dt current time step
-         * @param ui temporary step
-         * @param yi computed output step
-         *
-         * @details \f$y^{(j)} = \mu_j y^{(j-1)} + \nu_j y^{(j-2)} + \tilde{\mu}_j \Delta t f(t^n, y^{(j-1)})\f$
-         */
-        template <typename problem_t, typename state_t, typename array_ki_t, std::size_t j>
-        void
-        stage( Stage<j>, problem_t& f, value_t tn, state_t&, array_ki_t const& Yj, value_t dt, state_t& ui, state_t& yi )
-        {
-            f( tn, Yj[j - 1], ui );
-            yi = mu<j>() * Yj[j - 1] + nu<j>() * Yj[j - 2] + mu_t<j>() * dt * ui; // be careful Yj[j] is y^{(j+1)}
+            _info.number_of_stages = N_stages_;
+            _info.number_of_eval   = N_stages_;
         }
 
         /**
-         * @brief compute stage \f$0\f$ of RKL1 method
+         * @brief iteration of RKL1 method
          *
          * @tparam problem_t  type of operator \f$f\f$
          * @tparam state_t    type of current state
-         * @tparam array_ki_t type of array of temporary stages
-         * @param yn current state
-         * @param yi computed output step
-         *
-         * @details \f$y^{(0)} = y^n\f$
+         * @tparam array_ki_t type of temporary stages (only 3 needed for RKL1)
+         * @param f    operator \f$f\f$
+         * @param tn   current time
+         * @param yn   current state
+         * @param G    array of temporary stages
+         * @param dt   current time step
+         * @param ynp1 solution \f$y^{n+1}\f$ at time \f$t^{n+1} = t^n + \Delta t\f$
+         *
+         * @details \f$y^{(j)} = \mu_j y^{(j-1)} + \nu_j y^{(j-2)} + \tilde{\mu}_j \Delta t f(t^n, y^{(j-1)})\f$, with \f$y^{(0)} = y^n\f$ and
+         * \f$y^{(1)} = y^n + \tilde{\mu}_1 \Delta t f(t^n, y^n)\f$
          */
         template <typename problem_t, typename state_t, typename array_ki_t>
         void
-        stage( Stage<0>, problem_t&, value_t, state_t& yn, array_ki_t const&, value_t, state_t&, state_t& yi )
+        operator()( problem_t& f, value_t& tn, state_t& yn, array_ki_t& G, value_t& dt, state_t& ynp1 )
         {
-            yi = yn;
-        }
+            auto& yjm1  = G[0];
+            auto& yjm2  = G[1];
+            auto& f_tmp = G[2];
 
-        /**
-         * @brief compute stage \f$1\f$ of RKL1 method
-         *
-         * @tparam problem_t  type of operator \f$f\f$
-         * @tparam state_t    type of current state
-         * @tparam array_ki_t type of array of temporary stages
-         * @param f  operator \f$f\f$
-         * @param tn current time
-         * @param yn current state
-         * @param dt current time step
-         * @param ui temporary step
-         * @param yi computed output step
-         *
-         * @details \f$y^{(1)} = y^n + \tilde{\mu}_1 \Delta t f(t^n, y^n)\f$
-         */
-        template <typename problem_t, typename state_t, typename array_ki_t>
-        void
-        stage( Stage<1>, problem_t& f, value_t tn, state_t& yn, array_ki_t const&, value_t dt, state_t& ui, state_t& yi )
-        {
-            f( tn, yn, ui );
-            yi = yn + mu_t<1>() * dt * ui;
+            f( tn, yn, f_tmp );
+            yjm1 = yn + mu_t( 1 ) * dt * f_tmp;
+
+            if constexpr ( N_stages_ > 1 )
+            {
+                // y^{(2)} computed from y^{(0)} = y^n
+                f( tn, yjm1, f_tmp );
+                yjm2 = mu( 2 ) * yjm1 + nu( 2 ) * yn + mu_t( 2 ) * dt * f_tmp;
+                std::swap( yjm1, yjm2 );
+            }
+
+            for ( std::size_t j = 3; j <= N_stages_; ++j )
+            {
+                f( tn, yjm1, f_tmp );
+                yjm2 = mu( j ) * yjm1 + nu( j ) * yjm2 + mu_t( j ) * dt * f_tmp;
+                std::swap( yjm1, yjm2 );
+            }
+
+            tn = tn + dt;
+            std::swap( yjm1, ynp1 );
         }
 
         /**
@@ -164,64 +147,38 @@ namespace ponio::runge_kutta::legendre
     namespace details
     {
         /**
-         * @brief compute \f$b_j\f$ for \f$j\geq 2\f$
-         *
-         * @tparam value_t type of coefficient
-         * @tparam j       index \f$j\f$
-         *
-         * @details \f$b_j = \frac{j^2 + j - 2}{2j(j+1)}\f$
-         */
-        template <typename value_t, std::size_t j>
-        struct b
-        {
-            static constexpr value_t value = static_cast<value_t>( j * j + j - 2 ) / static_cast<value_t>( 2 * j * ( j + 1 ) );
-        };
-
-        /**
-         * @brief specialization of \f$b_j\f$ for \f$j=0\f$
+         * @brief compute \f$b_j\f$ coefficient
          *
          * @tparam value_t type of coefficient
+         * @param j        index \f$j\f$
          *
-         * @details \f$b_0 = \frac{1}{3}\f$
+         * @details \f$b_j = \frac{j^2 + j - 2}{2j(j+1)}\f$ for \f$j\geq 2\f$, and \f$b_0 = b_1 = \frac{1}{3}\f$
          */
         template <typename value_t>
-        struct b<value_t, 0>
+        constexpr value_t
+        b( std::size_t j )
         {
-            static constexpr value_t value = static_cast<value_t>( 1. / 3. );
-        };
-
-        /**
-         * @brief specialization of \f$b_j\f$ for \f$j=1\f$
-         *
-         * @tparam value_t type of coefficient
-         *
-         * @details \f$b_1 = \frac{1}{3}\f$
-         */
-        template <typename value_t>
-        struct b<value_t, 1>
-        {
-            static constexpr value_t value = static_cast<value_t>( 1. / 3. );
-        };
-
-        template <typename value_t, std::size_t j>
-        constexpr value_t b_v = b<value_t, j>::value;
+            if ( j < 2 )
+            {
+                return static_cast<value_t>( 1. / 3. );
+            }
+            return static_cast<value_t>( j * j + j - 2 ) / static_cast<value_t>( 2 * j * ( j + 1 ) );
+        }
 
         /**
          * @brief compute \f$a_j\f$ coefficient
          *
          * @tparam value_t type of coefficient
-         * @tparam j       index \f$j\f$
+         * @param j        index \f$j\f$
          *
          * @details \f$a_j = 1 - b_j\f$
          */
-        template <typename value_t, std::size_t j>
-        struct a
+        template <typename value_t>
+        constexpr value_t
+        a( std::size_t j )
         {
-            static constexpr value_t value = static_cast<value_t>( 1. ) - b_v<value_t, j>;
-        };
-
-        template <typename value_t, std::size_t j>
-        constexpr value_t a_v = a<value_t, j>::value;
+            return static_cast<value_t>( 1. ) - b<value_t>( j );
+        }
     } // namespace details
 
     /** @class explicit_rkl2
@@ -231,16 +188,19 @@ namespace ponio::runge_kutta::legendre
      * @tparam _value_t type of coefficients
      *
      * @warning the method is only presented with an autonomous problem, ie \f$\dot{y} = f(y)\f$
+     *
+     * @details the three-term recurrence is computed in place, so the method only stores 4 states whatever the number of stages
      */
     template <std::size_t N_stages_, typename _value_t = double>
     struct explicit_rkl2
     {
-        static_assert( N_stages_ > 0, "Number of stages should be at least 2 in eRKL2" );
-        static constexpr std::size_t N_stages = N_stages_;
-        static constexpr std::size_t order    = 2;
-        static constexpr std::string_view id  = "RKL2";
-        static constexpr bool is_embedded     = false;
-        using value_t                         = _value_t;
+        static_assert( N_stages_ > 1, "Number of stages should be at least 2 in eRKL2" );
+        static constexpr std::size_t N_stages  = stages::dynamic;
+        static constexpr std::size_t N_storage = 4;
+        static constexpr std::size_t order     = 2;
+        static constexpr std::string_view id   = "RKL2";
+        static constexpr bool is_embedded      = false;
+        using value_t                          = _value_t;
 
         iteration_info<explicit_rkl2> _info;
 
@@ -253,168 +213,114 @@ namespace ponio::runge_kutta::legendre
         static constexpr value_t
         w1()
         {
-            return static_cast<value_t>( 4. ) / static_cast<value_t>( N_stages * N_stages + N_stages - 2 );
+            return static_cast<value_t>( 4. ) / static_cast<value_t>( N_stages_ * N_stages_ + N_stages_ - 2 );
         }
 
         /**
          * @brief compute \f$\mu_j\f$ coefficient
          *
-         * @tparam j       index \f$j\f$
+         * @param j index \f$j\f$
          *
-         * @details \f$b_1 = \frac{1}{3}\f$
+         * @details \f$\mu_j = \frac{2j-1}{j}\frac{b_j}{b_{j-1}}\f$
          */
-        template <std::size_t j>
         static constexpr value_t
-        mu()
+        mu( std::size_t j )
         {
-            return static_cast<value_t>( 2 * j - 1 ) * details::b_v<value_t, j> / static_cast<value_t>( j * details::b_v<value_t, j - 1> );
+            return static_cast<value_t>( 2 * j - 1 ) * details::b<value_t>( j ) / ( static_cast<value_t>( j ) * details::b<value_t>( j - 1 ) );
         }
 
         /**
-         * @brief compute \f$\mu_j\f$ coefficient
+         * @brief compute \f$\nu_j\f$ coefficient
          *
-         * @tparam j       index \f$j\f$
+         * @param j index \f$j\f$
          *
-         * @details \f$mu_j = \frac{2j-1}{j}\frac{b_j}{b_{j-1}}\f$
+         * @details \f$\nu_j = -\frac{j-1}{j}\frac{b_j}{b_{j-2}}\f$
          */
-        template <std::size_t j>
         static constexpr value_t
-        nu()
+        nu( std::size_t j )
         {
-            return -static_cast<value_t>( ( j - 1 ) * details::b_v<value_t, j> ) / static_cast<value_t>( j * details::b_v<value_t, j - 2> );
+            return -static_cast<value_t>( j - 1 ) * details::b<value_t>( j ) / ( static_cast<value_t>( j ) * details::b<value_t>( j - 2 ) );
         }
 
         /**
          * @brief compute \f$\tilde{\mu}_j\f$ coefficient
          *
-         * @tparam j       index \f$j\f$
+         * @param j index \f$j\f$
          *
          * @details \f$\tilde{\mu}_j = \mu_j w_1\f$ for \f$1<j\f$, \f$\tilde{\mu}_1 - b_1w_1\f$
          */
-        template <std::size_t j>
         static constexpr value_t
-        mu_t()
+        mu_t( std::size_t j )
         {
-            if constexpr ( j == 1 )
+            if ( j == 1 )
             {
-                return details::b_v<value_t, 1> * w1();
-            }
-            else
-            {
-                return mu<j>() * w1();
+                return details::b<value_t>( 1 ) * w1();
             }
+            return mu( j ) * w1();
         }
 
         /**
          * @brief compute \f$\gamma_j\f$ coefficient
          *
-         * @tparam j       index \f$j\f$
+         * @param j index \f$j\f$
          *
          * @details \f$gamma_j = -a_{j-1}\tilde{\mu}_j\f$
          */
-        template <std::size_t j>
         static constexpr value_t
-        gamma_t()
+        gamma_t( std::size_t j )
         {
-            return -details::a_v<value_t, j - 1> * mu_t<j>();
+            return -details::a<value_t>( j - 1 ) * mu_t( j );
         }
 
         explicit_rkl2()
         {
-            _info.number_of_eval = N_stages;
+            _info.number_of_stages = N_stages_;
+            _info.number_of_eval   = N_stages_;
         }
 
         /**
-         * @brief compute stage \f$j\f$ of RKL2 method
+         * @brief iteration of RKL2 method
          *
          * @tparam problem_t  type of operator \f$f\f$
          * @tparam state_t    type of current state
-         * @tparam array_ki_t type of array of temporary stages
-         * @tparam j          integer of stage
-         * @param f  operator \f$f\f$
-         * @param tn current time
-         * @param yn current state
-         * @param Yj array of temporary stages
-         * @param dt current time step
-         * @param ui temporary step
-         * @param yi computed output step
+         * @tparam array_ki_t type of temporary stages (only 4 needed for RKL2)
+         * @param f    operator \f$f\f$
+         * @param tn   current time
+         * @param yn   current state
+         * @param G    array of temporary stages
+         * @param dt   current time step
+         * @param ynp1 solution \f$y^{n+1}\f$ at time \f$t^{n+1} = t^n + \Delta t\f$
          *
          * @details \f$y^{(j)} = \mu_j y^{(j-1)} + \nu_j y^{(j-2)} + (1-\mu_j-\nu_j)y^{(0)} + \tilde{\mu}_j \Delta t f(t^n, y^{(j-1)}) +
-         * \gamma_j\Delta t f(t^n, y^{(0)})\f$
-         */
-        template <typename problem_t, typename state_t, typename array_ki_t, std::size_t j>
-        void
-        stage( Stage<j>, problem_t& f, value_t tn, state_t& yn, array_ki_t const& Yj, value_t dt, state_t& ui, state_t& yi )
-        {
-            f( tn, Yj[j - 1], ui );
-            yi = mu<j>() * Yj[j - 1] + nu<j>() * Yj[j - 2] + ( 1. - mu<j>() - nu<j>() ) * yn + mu_t<j>() * dt * ui + gamma_t<j>() * Yj[0];
-        }
-
-        /**
-         * @brief compute \f$\Delta t f(t^n, y^n)\f$ term (needs for all other stages)
-         *
-         * @tparam problem_t  type of operator \f$f\f$
-         * @tparam state_t    type of current state
-         * @tparam array_ki_t type of array of temporary stages
-         * @param f  operator \f$f\f$
-         * @param tn current time
-         * @param yn current state
-         * @param dt current time step
-         * @param ui temporary step
-         * @param yi computed output step
-         *
-         * @warning first stage of RKL2 method is \f$y^n\f$ but here we compute \f$\Delta t f(t^n, y^n)\f$ term
+         * \gamma_j\Delta t f(t^n, y^{(0)})\f$, with \f$y^{(0)} = y^n\f$ and \f$y^{(1)} = y^n + \tilde{\mu}_1 \Delta t f(t^n, y^n)\f$
          */
         template <typename problem_t, typename state_t, typename array_ki_t>
         void
-        stage( Stage<0>, problem_t& f, value_t tn, state_t& yn, array_ki_t const&, value_t dt, state_t& ui, state_t& yi )
+        operator()( problem_t& f, value_t& tn, state_t& yn, array_ki_t& G, value_t& dt, state_t& ynp1 )
         {
-            f( tn, yn, ui );
-            yi = dt * ui; // be careful Yj[0] is dt*f(tn, yn)
-        }
+            auto& dt_f0 = G[0];
+            auto& yjm1  = G[1];
+            auto& yjm2  = G[2];
+            auto& f_tmp = G[3];
 
-        /**
-         * @brief compute stage \f$1\f$ of RKL2 method
-         *
-         * @tparam problem_t  type of operator \f$f\f$
-         * @tparam state_t    type of current state
-         * @tparam array_ki_t type of array of temporary stages
-         * @param yn current state
-         * @param Yj array of temporary stages
-         * @param yi computed output step
-         *
-         * @details \f$y^{(1)} = y^n + \tilde{\mu}_1 \Delta t f(t^n, y^n)\f$
-         */
-        template <typename problem_t, typename state_t, typename array_ki_t>
-        void
-        stage( Stage<1>, problem_t&, value_t, state_t& yn, array_ki_t const& Yj, value_t, state_t&, state_t& yi )
-        {
-            yi = yn + mu_t<1>() * Yj[0];
-        }
+            f( tn, yn, f_tmp );
+            dt_f0 = dt * f_tmp; // be careful G[0] stores dt*f(tn, yn)
+            yjm1  = yn + mu_t( 1 ) * dt_f0;
 
-        /**
-         * @brief compute stage \f$2\f$ of RKL2 method
-         *
-         * @tparam problem_t  type of operator \f$f\f$
-         * @tparam state_t    type of current state
-         * @tparam array_ki_t type of array of temporary stages
-         * @param f  operator \f$f\f$
-         * @param tn current time
-         * @param yn current state
-         * @param Yj array of temporary stages
-         * @param dt current time step
-         * @param ui temporary step
-         * @param yi computed output step
-         *
-         * @details \f$y^{(2)} = \mu_2 y^{(1)} + \nu_2y^n + (1-\mu_2-\nu_2)y^n + \tilde{\mu}_2\Delta tf(t^n, y^{(1)}) + \gamma_2\Delta t
-         * f(t^n, y^n)\f$
-         */
-        template <typename problem_t, typename state_t, typename array_ki_t>
-        void
-        stage( Stage<2>, problem_t& f, value_t tn, state_t& yn, array_ki_t const& Yj, value_t dt, state_t& ui, state_t& yi )
-        {
-            f( tn, Yj[1], ui );
-            yi = mu<2>() * Yj[1] + nu<2>() * yn + ( 1. - mu<2>() - nu<2>() ) * yn + mu_t<2>() * dt * ui + gamma_t<2>() * Yj[0];
+            // y^{(2)} computed from y^{(0)} = y^n
+            f( tn, yjm1, f_tmp );
+            yjm2 = mu( 2 ) * yjm1 + nu( 2 ) * yn + ( 1. - mu( 2 ) - nu( 2 ) ) * yn + mu_t( 2 ) * dt * f_tmp + gamma_t( 2 ) * dt_f0;
+            std::swap( yjm1, yjm2 );
+
+            for ( std::size_t j = 3; j <= N_stages_; ++j )
+            {
+                f( tn, yjm1, f_tmp );
+                yjm2 = mu( j ) * yjm1 + nu( j ) * yjm2 + ( 1. - mu( j ) - nu( j ) ) * yn + mu_t( j ) * dt * f_tmp + gamma_t( j ) * dt_f0;
+                std::swap( yjm1, yjm2 );
+            }
+
+            tn = tn + dt;
+            std::swap( yjm1, ynp1 );
         }
 
         /**
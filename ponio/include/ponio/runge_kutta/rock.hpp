@@ -64,13 +64,14 @@ namespace ponio::runge_kutta::rock
         norm_2( state_t const& u )
         {
             using namespace std;
-            return sqrt( std::accumulate( std::ranges::begin( u ),
+            auto const local_sum = std::accumulate( std::ranges::begin( u ),
                 std::ranges::end( u ),
                 0.,
                 []( auto sum, auto x )
                 {
                     return sum + ::ponio::detail::power<2>( abs( x ) );
-                } ) );
+                } );
+            return sqrt( ::ponio::detail::reduce_sum( u, local_sum ) );
         }
 
         /**
@@ -388,18 +389,7 @@ namespace ponio::runge_kutta::rock
             requires( std::ranges::range<state_t> )
         auto error( state_t&& unp1, state_t&& un, state_t&& tmp )
         {
-            auto it_un  = std::ranges::begin( std::forward<state_t>( un ) );
-            auto it_tmp = std::ranges::begin( std::forward<state_t>( tmp ) );
-
-            using namespace std;
-            return sqrt( std::accumulate( std::ranges::begin( std::forward<state_t>( unp1 ) ),
-                             std::ranges::end( std::forward<state_t>( unp1 ) ),
-                             0.,
-                             [&]( auto sum, auto unp1_i )
-                             {
-                                 return sum + ::ponio::detail::power<2>( error( unp1_i, *it_un++, *it_tmp++ ) );
-                             } )
-                         / static_cast<value_t>( std::size( unp1 ) ) );
+            return _error_rms( unp1, std::forward<state_t>( unp1 ), std::forward<state_t>( un ), std::forward<state_t>( tmp ) );
         }
 
         // same with something which contains a range
@@ -407,7 +397,31 @@ namespace ponio::runge_kutta::rock
             requires( !std::ranges::range<state_t> && ::ponio::detail::has_array_range<state_t> )
         auto error( state_t&& unp1, state_t&& un, state_t&& tmp )
         {
-            return error( unp1.array(), un.array(), tmp.array() );
+            return _error_rms( unp1, unp1.array(), un.array(), tmp.array() );
+        }
+
+        /**
+         * @brief root mean square of errors of ranges, reduced over all processes which share state `u` (see @ref
+         * ponio::global_reduction)
+         */
+        template <typename state_t, typename range_t>
+        auto
+        _error_rms( state_t const& u, range_t&& unp1, range_t&& un, range_t&& tmp )
+        {
+            auto it_un  = std::ranges::begin( std::forward<range_t>( un ) );
+            auto it_tmp = std::ranges::begin( std::forward<range_t>( tmp ) );
+
+            auto const local_sum = std::accumulate( std::ranges::begin( std::forward<range_t>( unp1 ) ),
+                std::ranges::end( std::forward<range_t>( unp1 ) ),
+                0.,
+                [&]( auto sum, auto unp1_i )
+                {
+                    return sum + ::ponio::detail::power<2>( error( unp1_i, *it_un++, *it_tmp++ ) );
+                } );
+            auto const n = static_cast<value_t>( std::size( unp1 ) );
+
+            using namespace std;
+            return sqrt( ::ponio::detail::reduce_sum( u, local_sum ) / ::ponio::detail::reduce_sum( u, n ) );
         }
 
         /**
@@ -618,7 +632,7 @@ namespace ponio::runge_kutta::rock
     {
         static constexpr bool is_embedded      = _is_embedded;
         static constexpr std::size_t N_stages  = stages::dynamic;
-        static constexpr std::size_t N_storage = 7;
+        static constexpr std::size_t N_storage = ::ponio::detail::conditional_v<is_embedded, std::size_t, 5, 4>;
         static constexpr std::size_t order     = 4;
         static constexpr std::string_view id   = "ROCK4";
 
@@ -667,23 +681,36 @@ namespace ponio::runge_kutta::rock
             requires( std::ranges::range<state_t> )
         auto error( state_t const& unp1, state_t const& tmp )
         {
-            auto it_tmp = std::ranges::begin( tmp );
-
-            return std::sqrt( std::accumulate( std::ranges::begin( unp1 ),
-                                  std::ranges::end( unp1 ),
-                                  0.,
-                                  [&]( auto sum, auto unp1_i )
-                                  {
-                                      return sum + ::ponio::detail::power<2>( error( unp1_i, *it_tmp++ ) );
-                                  } )
-                              / static_cast<value_t>( std::size( unp1 ) ) );
+            return _error_rms( unp1, unp1, tmp );
         }
 
         template <typename state_t>
             requires( !std::ranges::range<state_t> && ::ponio::detail::has_array_range<state_t> )
         auto error( state_t const& unp1, state_t const& tmp )
         {
-            return error( unp1.array(), tmp.array() );
+            return _error_rms( unp1, unp1.array(), tmp.array() );
+        }
+
+        /**
+         * @brief root mean square of errors of ranges, reduced over all processes which share state `u` (see @ref
+         * ponio::global_reduction)
+         */
+        template <typename state_t, typename range_t>
+        auto
+        _error_rms( state_t const& u, range_t const& unp1, range_t const& tmp )
+        {
+            auto it_tmp = std::ranges::begin( tmp );
+
+            auto const local_sum = std::accumulate( std::ranges::begin( unp1 ),
+                std::ranges::end( unp1 ),
+                0.,
+                [&]( auto sum, auto unp1_i )
+                {
+                    return sum + ::ponio::detail::power<2>( error( unp1_i, *it_tmp++ ) );
+                } );
+            auto const n = static_cast<value_t>( std::size( unp1 ) );
+
+            return std::sqrt( ::ponio::detail::reduce_sum( u, local_sum ) / ::ponio::detail::reduce_sum( u, n ) );
         }
 
         /**
@@ -691,7 +718,7 @@ namespace ponio::runge_kutta::rock
          *
          * @tparam problem_t  type of \f$f\f$
          * @tparam state_t    type of current state
-         * @tparam array_ki_t type of temporary stages (only 6 needed for ROCK4)
+         * @tparam array_ki_t type of temporary stages (4 needed for ROCK4, 5 for embedded version)
          * @param f     operator \f$f\f$
          * @param tn    current time
          * @param un    current state
@@ -713,14 +740,11 @@ namespace ponio::runge_kutta::rock
             _info.number_of_stages = mdeg + 4;
             _info.number_of_eval   = n_eval + mdeg + 4;
 
-            auto& uj    = G[0];
-            auto& ujm1  = G[1];
-            auto& ujm2  = G[2];
-            auto& ujm3  = G[3];
-            auto& ujm4  = G[4];
-            auto& f_tmp = G[5];
+            // three registers for the Chebyshev recurrence, updated in place
+            auto& ujm1  = G[0];
+            auto& ujm2  = G[1];
+            auto& f_tmp = G[2];
 
-            uj   = un;
             ujm2 = un;
 
             value_t const mu1 = dt * rock_coeff::recf[start_index - 1];
@@ -731,11 +755,6 @@ namespace ponio::runge_kutta::rock
             f( tn, un, f_tmp );
             ujm1 = un + mu1 * f_tmp;
 
-            if ( mdeg < 2 )
-            {
-                uj = ujm1;
-            }
-
             for ( std::size_t j = 2; j < mdeg + 1; ++j )
             {
                 value_t const mu    = rock_coeff::recf[start_index + 2 * ( j - 2 ) + 1 - 1];
@@ -743,16 +762,11 @@ namespace ponio::runge_kutta::rock
                 value_t const nu    = -1.0 - kappa;
 
                 f( t_jm1, ujm1, f_tmp );
-                uj = dt * mu * f_tmp - nu * ujm1 - kappa * ujm2;
+                ujm2 = dt * mu * f_tmp - nu * ujm1 - kappa * ujm2; // u_j overwrites u_{j-2}
+                std::swap( ujm1, ujm2 );
 
                 t_jm1 = dt * mu + nu * t_jm2 - kappa * t_jm3;
 
-                if ( j < mdeg )
-                {
-                    std::swap( ujm2, ujm1 );
-                    std::swap( ujm1, uj );
-                }
-
                 t_jm3 = t_jm2;
                 t_jm2 = t_jm1;
             }
@@ -770,41 +784,63 @@ namespace ponio::runge_kutta::rock
             value_t const b_3  = dt * rock_coeff::fpb[deg_index - 1][2];
             value_t const b_4  = dt * rock_coeff::fpb[deg_index - 1][3];
 
+            // for embedded method for error estimation
+            [[maybe_unused]] value_t const bh_1 = dt * ( rock_coeff::fpbe[deg_index - 1][0] - rock_coeff::fpb[deg_index - 1][0] );
+            [[maybe_unused]] value_t const bh_2 = dt * ( rock_coeff::fpbe[deg_index - 1][1] - rock_coeff::fpb[deg_index - 1][1] );
+            [[maybe_unused]] value_t const bh_3 = dt * ( rock_coeff::fpbe[deg_index - 1][2] - rock_coeff::fpb[deg_index - 1][2] );
+            [[maybe_unused]] value_t const bh_4 = dt * ( rock_coeff::fpbe[deg_index - 1][3] - rock_coeff::fpb[deg_index - 1][3] );
+            [[maybe_unused]] value_t const bh_5 = dt * rock_coeff::fpbe[deg_index - 1][4];
+
+            // the finish procedure reuses registers: `us` holds u_s then the partial sum of the fourth stage, `k_odd` holds k_1 then
+            // k_3, `k_even` holds k_2 then k_4, `u_stage` holds the second and third stages, the solution is accumulated in `unp1`
+            auto& us      = ujm1;
+            auto& k_odd   = ujm2;
+            auto& u_stage = f_tmp;
+            auto& k_even  = G[3];
+
             // stage 1.
-            f( t_jm1, uj, ujm1 );
-            ujm3 = uj + a_21 * ujm1;
+            f( t_jm1, us, k_odd );
+            unp1    = us + b_1 * k_odd;
+            u_stage = us + a_21 * k_odd;
+            if constexpr ( is_embedded )
+            {
+                G[4] = bh_1 * k_odd;
+            }
 
             // stage 2.
             t_jm2 = t_jm1 + a_21;
-            f( t_jm2, ujm3, ujm2 );
-            ujm4 = uj + a_31 * ujm1 + a_32 * ujm2;
+            f( t_jm2, u_stage, k_even );
+            unp1    = unp1 + b_2 * k_even;
+            u_stage = us + a_31 * k_odd + a_32 * k_even;
+            us      = us + a_41 * k_odd + a_42 * k_even;
+            if constexpr ( is_embedded )
+            {
+                G[4] = G[4] + bh_2 * k_even;
+            }
 
             // stage 3.
             t_jm2 = t_jm1 + a_31 + a_32;
-            f( t_jm2, ujm4, ujm3 );
-            ujm4 = uj + a_41 * ujm1 + a_42 * ujm2 + a_43 * ujm3;
+            f( t_jm2, u_stage, k_odd );
+            unp1 = unp1 + b_3 * k_odd;
+            us   = us + a_43 * k_odd;
+            if constexpr ( is_embedded )
+            {
+                G[4] = G[4] + bh_3 * k_odd;
+            }
 
             // stage 4.
             t_jm2 = t_jm1 + a_41 + a_42 + a_43;
+            f( t_jm2, us, k_even );
+            unp1 = unp1 + b_4 * k_even;
 
             if constexpr ( is_embedded )
             {
-                auto& tmp = G[6];
-
-                // for embedded method for error estimation
-                value_t const bh_1 = dt * ( rock_coeff::fpbe[deg_index - 1][0] - rock_coeff::fpb[deg_index - 1][0] );
-                value_t const bh_2 = dt * ( rock_coeff::fpbe[deg_index - 1][1] - rock_coeff::fpb[deg_index - 1][1] );
-                value_t const bh_3 = dt * ( rock_coeff::fpbe[deg_index - 1][2] - rock_coeff::fpb[deg_index - 1][2] );
-                value_t const bh_4 = dt * ( rock_coeff::fpbe[deg_index - 1][3] - rock_coeff::fpb[deg_index - 1][3] );
-                value_t const bh_5 = dt * rock_coeff::fpbe[deg_index - 1][4];
-
-                f( t_jm2, ujm4, tmp );
-                uj = uj + b_1 * ujm1 + b_2 * ujm2 + b_3 * ujm3 + b_4 * tmp;
+                auto& tmp = G[4];
 
-                f( t_jm2, uj, f_tmp );
-                tmp = bh_1 * ujm1 + bh_2 * ujm2 + bh_3 * ujm3 + bh_4 * tmp + bh_5 * f_tmp;
+                f( t_jm2, unp1, k_odd );
+                tmp = tmp + bh_4 * k_even + bh_5 * k_odd;
 
-                _info.error   = error( uj, tmp );
+                _info.error   = error( unp1, tmp );
                 _info.success = _info.error < 1.0;
                 _info.number_of_eval += 1; // one of two evaluations already count
 
@@ -817,7 +853,6 @@ namespace ponio::runge_kutta::rock
                 if ( _info.success )
                 {
                     tn = tn + dt;
-                    std::swap( uj, unp1 );
                     dt = new_dt;
                 }
                 else
@@ -829,10 +864,7 @@ namespace ponio::runge_kutta::rock
             }
             else
             {
-                f( t_jm2, ujm4, f_tmp );
-
-                tn   = tn + dt;
-                unp1 = uj + b_1 * ujm1 + b_2 * ujm2 + b_3 * ujm3 + b_4 * f_tmp;
+                tn = tn + dt;
             }
         }
 
@@ -5,6 +5,9 @@
 #pragma once
 
 #include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
 
 #include "linear_algebra.hpp"
 
@@ -48,6 +51,50 @@ namespace ponio::linear_algebra
     template <typename solver_t>
     concept has_Snes_method = std::is_member_function_pointer_v<decltype( &solver_t::Snes )>;
 
+    namespace detail
+    {
+        /**
+         * @brief solver on an implicit operator \f$I - \alpha R\f$ stored in a \ref solver_cache, with the operator it is built on
+         *
+         * @tparam operator_t type of implicit operator
+         * @tparam field_t    type of samurai field
+         */
+        template <typename operator_t, typename field_t>
+        struct implicit_solver_entry
+        {
+            using value_t   = typename field_t::value_type;
+            using mesh_t    = typename field_t::mesh_t;
+            using mesh_id_t = typename mesh_t::mesh_id_t;
+            using cells_t   = std::remove_cvref_t<decltype( std::declval<mesh_t const&>()[mesh_id_t::cells] )>;
+            using solver_t  = decltype( samurai::petsc::make_solver( std::declval<operator_t&>() ) );
+
+            operator_t op;
+            solver_t solver;
+            value_t alpha;
+            cells_t cells; // cells of the mesh where the solver is built
+
+            implicit_solver_entry( operator_t&& _op, value_t _alpha, mesh_t const& mesh )
+                : op( std::move( _op ) )
+                , solver( samurai::petsc::make_solver( op ) )
+                , alpha( _alpha )
+                , cells( mesh[mesh_id_t::cells] )
+            {
+            }
+
+            /**
+             * @brief checks if solver is still valid for a given \f$\alpha\f$ and a mesh
+             *
+             * @param _alpha coefficient \f$\alpha\f$
+             * @param mesh   current mesh
+             */
+            bool
+            is_assembled( value_t _alpha, mesh_t const& mesh ) const
+            {
+                return _alpha == alpha && mesh[mesh_id_t::cells] == cells;
+            }
+        };
+    } // namespace detail
+
     template <typename field_t>
         requires ::ponio_samurai::is_samurai_field<field_t>
     struct operator_algebra<field_t>
@@ -59,15 +106,63 @@ namespace ponio::linear_algebra
             return ::samurai::make_identity<state_t>();
         }
 
-        template <typename operator_t, typename state_t, typename rhs_t>
+        /**
+         * @brief builds a solver on operator `op` that can be reused for several right hand sides
+         *
+         * @param op operator to inverse
+         */
+        template <typename operator_t>
+        static auto
+        make_solver( operator_t& op )
+        {
+            return samurai::petsc::make_solver( op );
+        }
+
+        /**
+         * @brief builds a solver on operator \f$I - \alpha R\f$ that can be reused for several right hand sides, and keeps it in `cache`
+         *
+         * @param cache cache of the solver between two calls
+         * @param alpha coefficient \f$\alpha\f$ (\f$\gamma\Delta t\f$ in PIROCK)
+         * @param op_R  operator \f$R\f$
+         * @param u     current state, the solver is built on its mesh
+         *
+         * @details for a linear operator \f$R\f$ (scheme type other than `samurai::SchemeType::NonLinear`), the stored solver is reused
+         * while \f$\alpha\f$ and the cells of the mesh do not change. For a non-linear operator, a new solver is built at each call.
+         */
+        template <typename operator_t, typename state_t>
+        static auto&
+        make_solver( solver_cache& cache, typename field_t::value_type alpha, operator_t&& op_R, state_t const& u )
+        {
+            using cfg_t                       = typename std::remove_cvref_t<operator_t>::cfg_t;
+            bool constexpr is_linear_operator = cfg_t::scheme_type != ::samurai::SchemeType::NonLinear;
+
+            using implicit_operator_t = std::remove_cvref_t<decltype( identity( u ) - alpha * op_R )>;
+            using entry_t             = detail::implicit_solver_entry<implicit_operator_t, field_t>;
+
+            auto* entry = cache.template get<entry_t>();
+            if ( !is_linear_operator || entry == nullptr || !entry->is_assembled( alpha, u.mesh() ) )
+            {
+                entry = &cache.template emplace<entry_t>( identity( u ) - alpha * op_R, alpha, u.mesh() );
+            }
+            return entry->solver;
+        }
+
+        /**
+         * @brief solves \f$op(u) = rhs\f$ with a solver previously built by `make_solver`
+         *
+         * @param solver solver on operator \f$op\f$
+         * @param u      unknown, initial guess as input
+         * @param rhs    right hand side
+         * @param n_eval number of evaluations of operator (only for non-linear solver)
+         */
+        template <typename solver_t, typename state_t, typename rhs_t>
         static void
-        solve( operator_t& op, state_t& u, rhs_t& rhs, std::size_t& n_eval )
+        solve_with( solver_t& solver, state_t& u, rhs_t& rhs, std::size_t& n_eval )
         {
-            auto solver = samurai::petsc::make_solver( op );
-            auto _rhs   = static_cast<state_t>( rhs );
+            auto _rhs = static_cast<state_t>( rhs );
             solver.solve( u, _rhs );
 
-            if constexpr ( operator_t::cfg_t::scheme_type == samurai::SchemeType::NonLinear && has_Snes_method<decltype( solver )> )
+            if constexpr ( has_Snes_method<solver_t> )
             {
                 int i_n_eval = 0;
                 SNESGetNumberFunctionEvals( solver.Snes(), &i_n_eval );
@@ -79,6 +174,14 @@ namespace ponio::linear_algebra
                 // linear solver, no evaluation of function
                 n_eval = 0;
             }
+        }
+
+        template <typename operator_t, typename state_t, typename rhs_t>
+        static void
+        solve( operator_t& op, state_t& u, rhs_t& rhs, std::size_t& n_eval )
+        {
+            auto solver = make_solver( op );
+            solve_with( solver, u, rhs, n_eval );
 
             //::samurai::petsc::solve( op, u, rhs );
         }
@@ -92,12 +195,98 @@ namespace ponio::shampine_trick
      * @brief For PIROCK method, compute the Shampine's trick
      *
      * @tparam field_t type of samurai field
+     *
+     * @details for a linear reaction operator (scheme type other than `samurai::SchemeType::NonLinear`), the matrix
+     * \f$I - \alpha J_R\f$ and its KSP solver (with the preconditioner) are kept between two calls, they are only assembled again when
+     * \f$\alpha = \gamma\Delta t\f$ or the cells of the mesh change. For a non-linear reaction operator, \f$J_R\f$ is the Jacobian at
+     * the current state, so the matrix is assembled at each call.
      */
     template <typename field_t>
         requires ::ponio_samurai::is_samurai_field<field_t>
     struct shampine_trick<field_t>
     {
-        using value_t = typename field_t::value_type;
+        using value_t   = typename field_t::value_type;
+        using mesh_t    = typename field_t::mesh_t;
+        using mesh_id_t = typename mesh_t::mesh_id_t;
+        using cells_t   = std::remove_cvref_t<decltype( std::declval<mesh_t const&>()[mesh_id_t::cells] )>;
+
+        Mat J_R           = nullptr;
+        KSP ksp           = nullptr;
+        value_t alpha_J_R = static_cast<value_t>( 0. );
+        cells_t J_R_cells; // cells of the mesh where J_R is assembled
+
+        shampine_trick() = default;
+
+        // PETSc objects are never shared, a copy assembles its own matrix on first call
+        shampine_trick( shampine_trick const& )
+            : shampine_trick()
+        {
+        }
+
+        shampine_trick( shampine_trick&& other ) noexcept
+            : J_R( std::exchange( other.J_R, nullptr ) )
+            , ksp( std::exchange( other.ksp, nullptr ) )
+            , alpha_J_R( other.alpha_J_R )
+            , J_R_cells( std::move( other.J_R_cells ) )
+        {
+        }
+
+        shampine_trick&
+        operator=( shampine_trick const& other )
+        {
+            if ( this != &other )
+            {
+                reset();
+            }
+            return *this;
+        }
+
+        shampine_trick&
+        operator=( shampine_trick&& other ) noexcept
+        {
+            if ( this != &other )
+            {
+                reset();
+                J_R       = std::exchange( other.J_R, nullptr );
+                ksp       = std::exchange( other.ksp, nullptr );
+                alpha_J_R = other.alpha_J_R;
+                J_R_cells = std::move( other.J_R_cells );
+            }
+            return *this;
+        }
+
+        ~shampine_trick()
+        {
+            reset();
+        }
+
+        /**
+         * @brief destroys stored matrix and solver, next call assembles them again
+         */
+        void
+        reset()
+        {
+            if ( ksp != nullptr )
+            {
+                KSPDestroy( &ksp );
+            }
+            if ( J_R != nullptr )
+            {
+                MatDestroy( &J_R );
+            }
+        }
+
+        /**
+         * @brief checks if stored matrix of a linear reaction operator is still valid for a given \f$\alpha\f$ and a mesh
+         *
+         * @param alpha \f$\alpha = \gamma\Delta t\f$
+         * @param mesh  current mesh
+         */
+        bool
+        is_assembled( value_t alpha, mesh_t const& mesh ) const
+        {
+            return ksp != nullptr && alpha == alpha_J_R && mesh[mesh_id_t::cells] == J_R_cells;
+        }
 
         /**
          * @brief solves \f$(I - \alpha R)^{\ell}X = b\f$
@@ -116,7 +305,9 @@ namespace ponio::shampine_trick
         void
         operator()( value_t alpha, operator_t&& op_reac, state_t& initial_guess, state_t& rhs, state_t& u_tmp, state_t& shampine_result )
         {
-            bool constexpr is_local_operator = operator_t::cfg_t::stencil_size == 1;
+            using cfg_t                       = typename std::remove_cvref_t<operator_t>::cfg_t;
+            bool constexpr is_local_operator  = cfg_t::stencil_size == 1;
+            bool constexpr is_linear_operator = cfg_t::scheme_type != ::samurai::SchemeType::NonLinear;
 
             auto id = ::samurai::make_identity<state_t>();
             // matrix assembly
@@ -130,28 +321,35 @@ namespace ponio::shampine_trick
                 assembly.include_bc( false );
             }
 
-            Mat J_R;
-            assembly.create_matrix( J_R );
-            assembly.assemble_matrix( J_R );
-
-            // linear solver
-            KSP ksp;
-            KSPCreate( PETSC_COMM_SELF, &ksp );
-            KSPSetFromOptions( ksp );
-            KSPSetOperators( ksp, J_R, J_R );
-            PetscInt const err = KSPSetUp( ksp );
-            if ( err != 0 )
-            {
-                std::cerr << "The setup of the solver failed!" << std::endl;
-                exit( EXIT_FAILURE ); // NOLINT
-            }
-
             auto& result_l1 = ( ell == 1 ) ? shampine_result : u_tmp;
 
-            // Solve the system
             Vec rhs_petsc   = samurai::petsc::create_petsc_vector_from( rhs );
             Vec u_tmp_petsc = samurai::petsc::create_petsc_vector_from( result_l1 );
 
+            // the Jacobian of a non-linear operator depends on `initial_guess`, it is never reused
+            if ( !is_linear_operator || !is_assembled( alpha, initial_guess.mesh() ) )
+            {
+                reset();
+
+                assembly.create_matrix( J_R );
+                assembly.assemble_matrix( J_R );
+
+                // linear solver
+                KSPCreate( PETSC_COMM_SELF, &ksp );
+                KSPSetFromOptions( ksp );
+                KSPSetOperators( ksp, J_R, J_R );
+                PetscInt const err = KSPSetUp( ksp );
+                if ( err != 0 )
+                {
+                    std::cerr << "The setup of the solver failed!" << std::endl;
+                    exit( EXIT_FAILURE ); // NOLINT
+                }
+
+                alpha_J_R = alpha;
+                J_R_cells = initial_guess.mesh()[mesh_id_t::cells];
+            }
+
+            // Solve the system
             assembly.set_0_for_all_ghosts( rhs_petsc );
 
             KSPSolve( ksp, rhs_petsc, u_tmp_petsc );
@@ -179,8 +377,6 @@ namespace ponio::shampine_trick
 
             VecDestroy( &u_tmp_petsc );
             VecDestroy( &rhs_petsc );
-            KSPDestroy( &ksp );
-            MatDestroy( &J_R );
         }
     };
 
@@ -10,6 +10,7 @@
 #include <limits>
 #include <optional>
 
+#include "detail.hpp"
 #include "method.hpp"
 #include "stage.hpp"
 #include "time_span.hpp"
@@ -93,6 +94,7 @@ namespace ponio
         ponio::time_span<value_t> t_span;
         typename ponio::time_span<value_t>::iterator it_next_time;
         std::optional<value_t> dt_reference;
+        detail::compensated_sum<value_t> time_sum; /**< compensated sum of time steps (used if `PONIO_USE_COMPENSATED_SUM` is defined) */
         static constexpr value_t sentinel = std::numeric_limits<value_t>::max();
 
         /**
@@ -114,6 +116,7 @@ namespace ponio
             , t_span( t_span_ )
             , it_next_time( std::next( std::begin( t_span ) ) )
             , dt_reference( std::nullopt )
+            , time_sum()
         {
         }
 
@@ -132,6 +135,7 @@ namespace ponio
             , t_span( rhs.t_span )
             , it_next_time( std::begin( t_span ) + std::ranges::distance( std::begin( rhs.t_span ), rhs.it_next_time ) )
             , dt_reference( rhs.dt_reference )
+            , time_sum( rhs.time_sum )
         {
         }
 
@@ -148,6 +152,7 @@ namespace ponio
             , t_span( std::move( rhs.t_span ) )
             , it_next_time( std::move( rhs.it_next_time ) )
             , dt_reference( std::move( rhs.dt_reference ) )
+            , time_sum( rhs.time_sum )
         {
         }
 
@@ -169,6 +174,7 @@ namespace ponio
                 t_span       = rhs.t_span;
                 it_next_time = std::begin( t_span ) + std::ranges::distance( std::begin( rhs.t_span ), rhs.it_next_time );
                 dt_reference = rhs.dt_reference;
+                time_sum     = rhs.time_sum;
             }
 
             return *this;
@@ -192,6 +198,7 @@ namespace ponio
                 t_span       = std::move( rhs.t_span );
                 it_next_time = std::move( rhs.it_next_time );
                 dt_reference = std::move( rhs.dt_reference );
+                time_sum     = rhs.time_sum;
             }
 
             return *this;
@@ -203,13 +210,47 @@ namespace ponio
          * @brief increment current state by current time step
          *
          * @details \f$(t^n, u^n, \Delta t^n ) \gets \phi(t^n, u^n, \Delta t^n)\f$ where \f$\phi\f$ represents the method.
+         *
+         * If ponio is compiled with `PONIO_USE_COMPENSATED_SUM`, the new time of a successful step is the compensated sum of time steps
+         * (see @ref detail::compensated_sum), and a step shortened to reach a time of `t_span` ends exactly on it.
          */
         void
         increment()
         {
+            [[maybe_unused]] value_t const tn = sol.time;
+            [[maybe_unused]] value_t const dt = sol.time_step;
+
             // std::tie( sol.time, sol.state, sol.time_step ) = meth( pb, sol.time, sol.state, sol.time_step );
             meth( pb, sol.time, sol.state, sol.time_step, u_tmp );
             std::swap( u_tmp, sol.state );
+
+#if defined( PONIO_USE_COMPENSATED_SUM )
+            if ( sol.time != tn )
+            {
+                if ( dt_reference.has_value() )
+                {
+                    // time step was shortened to reach previous time of `t_span`
+                    sol.time = time_sum.reset( *std::prev( it_next_time ) );
+                }
+                else if ( tn + dt == *it_next_time )
+                {
+                    // time step reaches next time of `t_span` up to rounding error
+                    sol.time = time_sum.reset( *it_next_time );
+                    if ( std::next( it_next_time ) != std::end( t_span ) )
+                    {
+                        ++it_next_time;
+                    }
+                }
+                else
+                {
+                    if ( time_sum.sum != tn )
+                    {
+                        time_sum.reset( tn );
+                    }
+                    sol.time = time_sum.add( dt );
+                }
+            }
+#endif
         }
 
         /**
@@ -382,10 +423,7 @@ namespace ponio
         void
         callback_on_stages( lambda_t&& f ) // cppcheck-suppress unusedFunction
         {
-            for ( auto& ki : stages() )
-            {
-                std::forward<lambda_t>( f )( ki );
-            }
+            detail::for_each_stage( stages(), f );
             std::forward<lambda_t>( f )( u_tmp );
         }
 
@@ -393,10 +431,7 @@ namespace ponio
         void
         callback_on_stages( sub_method<I> subI, lambda_t&& f ) // cppcheck-suppress unusedFunction
         {
-            for ( auto& ki : stages( subI ) )
-            {
-                std::forward<lambda_t>( f )( ki );
-            }
+            detail::for_each_stage( stages( subI ), f );
             std::forward<lambda_t>( f )( u_tmp );
         }
     };
@@ -651,6 +686,12 @@ namespace ponio
     {
         auto meth = make_method<value_t>( std::forward<algorithm_t>( algo ), u0 );
 
+        // problems which need temporary states allocate them once here, before any (possibly concurrent) evaluation
+        if constexpr ( requires { pb.allocate_buffers( u0 ); } )
+        {
+            pb.allocate_buffers( u0 );
+        }
+
         auto begin = make_time_iterator( pb, std::move( meth ), u0, t_span, dt );
         auto end   = make_sentinel_iterator<value_t>();
 
@@ -688,18 +729,62 @@ namespace ponio
 
         auto meth = make_method<value_t>( std::forward<Algorithm_t>( algo ), un );
 
+        // problems which need temporary states allocate them once here, before any (possibly concurrent) evaluation
+        if constexpr ( requires { pb.allocate_buffers( un ); } )
+        {
+            pb.allocate_buffers( un );
+        }
+
         obs( current_time, un, dt );
 
+#if defined( PONIO_USE_COMPENSATED_SUM )
+        detail::compensated_sum<value_t> time_sum;
+        value_t target_time = last_time; // time of `t_span` reached by a shortened time step
+        time_sum.reset( current_time );
+#endif
+
         while ( current_time < last_time )
         {
+#if defined( PONIO_USE_COMPENSATED_SUM )
+            value_t const tn  = current_time;
+            value_t const dtn = current_dt;
+#endif
+
             meth( pb, current_time, un, current_dt, un1 );
             std::swap( un, un1 );
 
+#if defined( PONIO_USE_COMPENSATED_SUM )
+            if ( current_time != tn )
+            {
+                if ( reset_dt && dtn == target_time - tn )
+                {
+                    // time step was shortened to reach a time of `t_span`
+                    current_time = time_sum.reset( target_time );
+                }
+                else if ( tn + dtn == *it_next_time )
+                {
+                    // time step reaches next time of `t_span` up to rounding error
+                    current_time = time_sum.reset( *it_next_time );
+                    if ( it_next_time != last_it )
+                    {
+                        ++it_next_time;
+                    }
+                }
+                else
+                {
+                    current_time = time_sum.add( dtn );
+                }
+            }
+#endif
+
             obs( current_time, un, current_dt );
 
             // prepare next step
             if ( current_time + current_dt > *it_next_time )
             {
+#if defined( PONIO_USE_COMPENSATED_SUM )
+                target_time = *it_next_time;
+#endif
                 current_dt = *it_next_time - current_time;
                 reset_dt   = true;
                 if ( it_next_time != last_it )
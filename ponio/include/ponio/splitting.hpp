@@ -5,16 +5,21 @@
 #pragma once
 
 // IWYU pragma: begin_exports
+#include "splitting/composition.hpp"
 #include "splitting/lie.hpp"
+#include "splitting/mri.hpp"
 #include "splitting/strang.hpp"
 
 // IWYU pragma: end_exports
 
 namespace ponio::splitting
 {
-    using lie::make_lie_tuple;                // NOLINT(misc-unused-using-decls): using to improve interface
-    using strang::make_adaptive_strang_tuple; // NOLINT(misc-unused-using-decls): using to improve interface
-    using strang::make_strang_tuple;          // NOLINT(misc-unused-using-decls): using to improve interface
+    using composition::make_composition_tuple;         // NOLINT(misc-unused-using-decls): using to improve interface
+    using lie::make_lie_tuple;                         // NOLINT(misc-unused-using-decls): using to improve interface
+    using mri::make_mri_gark_tuple;                    // NOLINT(misc-unused-using-decls): using to improve interface
+    using strang::make_adaptive_strang_tuple;          // NOLINT(misc-unused-using-decls): using to improve interface
+    using strang::make_parallel_adaptive_strang_tuple; // NOLINT(misc-unused-using-decls): using to improve interface
+    using strang::make_strang_tuple;                   // NOLINT(misc-unused-using-decls): using to improve interface
 
     template <typename T>
     concept is_splitting_method = requires( T t ) { static_cast<bool>( T::is_splitting_method ); };
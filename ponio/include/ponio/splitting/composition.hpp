@@ -0,0 +1,340 @@
+// Copyright 2022 PONIO TEAM. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+// IWYU pragma: private
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string_view> // NOLINT(misc-include-cleaner)
+#include <tuple>
+#include <utility>
+
+#include "../iteration_info.hpp"
+#include "../stage.hpp"
+#include "detail.hpp"
+
+namespace ponio::splitting::composition
+{
+
+    /**
+     * @brief one step of a composition method: solve sub-problem `op` on a fraction `coefficient` of the time step
+     */
+    struct composition_step
+    {
+        std::size_t op;
+        double coefficient;
+    };
+
+    /**
+     * @brief builds steps of a composition method for two sub-problems \f$A\f$ and \f$B\f$ from its coefficients \f$(a_i)\f$ and
+     * \f$(b_i)\f$:
+     * \f[
+     *      \mathcal{S}^{\Delta t} = \varphi^{[A]}_{a_1\Delta t}\circ\varphi^{[B]}_{b_1\Delta t}\circ\varphi^{[A]}_{a_2\Delta t}\circ\cdots
+     *      \circ\varphi^{[B]}_{b_s\Delta t}\circ\varphi^{[A]}_{a_{s+1}\Delta t}
+     * \f]
+     *
+     * @tparam s number of coefficients \f$b_i\f$
+     * @param a coefficients \f$(a_i)_{i=1,\dots,s+1}\f$ of first sub-problem
+     * @param b coefficients \f$(b_i)_{i=1,\dots,s}\f$ of second sub-problem
+     */
+    template <std::size_t s>
+    constexpr std::array<composition_step, 2 * s + 1>
+    from_coefficients( std::array<double, s + 1> const& a, std::array<double, s> const& b )
+    {
+        std::array<composition_step, 2 * s + 1> steps{};
+        for ( std::size_t i = 0; i < s; ++i )
+        {
+            steps[2 * i]     = { 0, a[i] };
+            steps[2 * i + 1] = { 1, b[i] };
+        }
+        steps[2 * s] = { 0, a[s] };
+
+        return steps;
+    }
+
+    /**
+     * @brief builds steps of a composition of Strang methods \f$\mathcal{S}^{\Delta t} = \mathcal{S}_2^{w_s\Delta t}\circ\cdots\circ
+     * \mathcal{S}_2^{w_1\Delta t}\f$ for two sub-problems, consecutive half steps of first sub-problem are merged
+     *
+     * @tparam s number of Strang steps
+     * @param w weights \f$(w_i)_{i=1,\dots,s}\f$ of each Strang step
+     */
+    template <std::size_t s>
+    constexpr std::array<composition_step, 2 * s + 1>
+    from_strang_weights( std::array<double, s> const& w )
+    {
+        std::array<double, s + 1> a{};
+        a[0] = 0.5 * w[0];
+        for ( std::size_t i = 1; i < s; ++i )
+        {
+            a[i] = 0.5 * ( w[i - 1] + w[i] );
+        }
+        a[s] = 0.5 * w[s - 1];
+
+        return from_coefficients<s>( a, w );
+    }
+
+    // ---- schemes -------------------------------------------------
+
+    /**
+     * @brief optimized second order method with 2 stages (McLachlan 1995), \f$a_1 = a_3 = \lambda\f$, \f$a_2 = 1 - 2\lambda\f$,
+     * \f$b_1 = b_2 = \frac{1}{2}\f$
+     */
+    struct mclachlan_2
+    {
+        static constexpr std::size_t N_operators = 2;
+        static constexpr std::size_t order       = 2;
+        static constexpr std::string_view id     = "mclachlan_2";
+
+        static constexpr double lambda = 0.1931833275037836;
+
+        static constexpr auto steps = from_coefficients<2>( { lambda, 1. - 2. * lambda, lambda }, { 0.5, 0.5 } );
+    };
+
+    /**
+     * @brief fourth order triple jump of Strang method (Yoshida 1990), \f$w_1 = w_3 = \frac{1}{2 - 2^{1/3}}\f$, \f$w_2 = 1 - 2w_1\f$
+     */
+    struct yoshida_4
+    {
+        static constexpr std::size_t N_operators = 2;
+        static constexpr std::size_t order       = 4;
+        static constexpr std::string_view id     = "yoshida_4";
+
+        static constexpr double w1 = 1.3512071919596576;
+
+        static constexpr auto steps = from_strang_weights<3>( { w1, 1. - 2. * w1, w1 } );
+    };
+
+    /**
+     * @brief fourth order composition of 5 Strang methods (Suzuki 1990), \f$w_1 = w_2 = w_4 = w_5 = \frac{1}{4 - 4^{1/3}}\f$,
+     * \f$w_3 = 1 - 4w_1\f$
+     *
+     * @details it has more stages than @ref yoshida_4 but smaller negative steps and a smaller error constant
+     */
+    struct suzuki_4
+    {
+        static constexpr std::size_t N_operators = 2;
+        static constexpr std::size_t order       = 4;
+        static constexpr std::string_view id     = "suzuki_4";
+
+        static constexpr double p = 0.41449077179437574;
+
+        static constexpr auto steps = from_strang_weights<5>( { p, p, 1. - 4. * p, p, p } );
+    };
+
+    /**
+     * @brief optimized fourth order method with 6 stages (Blanes and Moan 2002, \f$\mathcal{S}_6\f$ in table 2)
+     */
+    struct blanes_moan_4
+    {
+        static constexpr std::size_t N_operators = 2;
+        static constexpr std::size_t order       = 4;
+        static constexpr std::string_view id     = "blanes_moan_4";
+
+        static constexpr double a1 = 0.0792036964311957;
+        static constexpr double a2 = 0.353172906049774;
+        static constexpr double a3 = -0.0420650803577195;
+        static constexpr double a4 = 1. - 2. * ( a1 + a2 + a3 );
+        static constexpr double b1 = 0.209515106613362;
+        static constexpr double b2 = -0.143851773179818;
+        static constexpr double b3 = 0.5 - ( b1 + b2 );
+
+        static constexpr auto steps = from_coefficients<6>( { a1, a2, a3, a4, a3, a2, a1 }, { b1, b2, b3, b3, b2, b1 } );
+    };
+
+    // ---- class composition ---------------------------------------
+
+    /** @class composition
+     *  generic composition splitting method, defined by a list of steps \f$(k_j, c_j)\f$ which solves sub-problem \f$k_j\f$ on
+     *  \f$c_j\Delta t\f$
+     *  @tparam scheme_t  type which defines `steps`, `order` and `id` of the method
+     *  @tparam value_t   type of time steps
+     *  @tparam methods_t list of methods to solve each sub-problem
+     *
+     *  @details each sub-problem has its own time, advanced by its own coefficients, and negative coefficients solve the sub-problem
+     *  backward in time.
+     */
+    template <typename scheme_t, typename _value_t, typename... methods_t>
+    struct composition : detail::splitting_base<_value_t, methods_t...>
+    {
+        using value_t = _value_t;
+        using base_t  = detail::splitting_base<value_t, methods_t...>;
+
+        using base_t::splitting_base;
+
+        using base_t::is_splitting_method;
+        using base_t::N_methods;
+
+        using base_t::methods;
+        using base_t::time_steps;
+
+        static_assert( scheme_t::N_operators == N_methods, "Number of methods should be the number of operators of the composition scheme" );
+
+        static constexpr std::size_t order   = scheme_t::order;
+        static constexpr std::string_view id = scheme_t::id;
+        static constexpr std::size_t N_steps = std::tuple_size_v<decltype( scheme_t::steps )>;
+
+        iteration_info<composition> _info;
+
+        composition( std::tuple<methods_t...> const& meths, std::array<value_t, N_methods> const& dts )
+            : base_t( meths, dts )
+            , _info( methods )
+        {
+        }
+
+        /**
+         * @brief shares tolerances of a splitting step between embedded methods of its `N_steps` sub-steps (see @ref
+         * detail::share_error_budget)
+         *
+         * @param a_tol absolute tolerance for the whole splitting step
+         * @param r_tol relative tolerance for the whole splitting step
+         */
+        void
+        share_error_budget( value_t a_tol, value_t r_tol )
+        {
+            detail::share_error_budget( methods, a_tol, r_tol, N_steps );
+        }
+
+        // _call_inc can not be outside the class definition due to llvm bug
+        // (see https://github.com/llvm/llvm-project/issues/56482)
+        template <std::size_t J = 0, typename Problem_t, typename state_t>
+            requires( J == N_steps )
+        void _call_inc( Problem_t&, std::array<value_t, N_methods>&, state_t&, value_t, state_t& )
+        {
+        }
+
+        /**
+         * @brief incremental call of each step of the composition
+         *
+         * @tparam J index of step
+         * @param f     problem to solve
+         * @param times current time of each sub-problem
+         * @param ui    initial solution for step `J`
+         * @param dt    time step \f$\Delta t\f$
+         * @param uip1  solution \f$\texttt{uip1} = \varphi^{[k_j]}_{c_j\Delta t}(\texttt{ui})\f$
+         */
+        template <std::size_t J = 0, typename Problem_t, typename state_t>
+            requires( J < N_steps )
+        void _call_inc( Problem_t& f, std::array<value_t, N_methods>& times, state_t& ui, value_t dt, state_t& uip1 )
+        {
+            static constexpr std::size_t I = scheme_t::steps[J].op;
+
+            value_t const sub_dt = static_cast<value_t>( scheme_t::steps[J].coefficient ) * dt;
+
+            detail::_split_solve<I>( f, methods, ui, times[I], times[I] + sub_dt, time_steps[I], uip1, _info );
+            times[I] += sub_dt;
+
+            _call_inc<J + 1>( f, times, uip1, dt, ui );
+        }
+
+        template <typename Problem_t, typename state_t>
+        void
+        operator()( Problem_t& f, value_t& tn, state_t& un, value_t& dt, state_t& unp1 );
+
+        /**
+         * @brief gets `iteration_info` object
+         */
+        auto&
+        info()
+        {
+            return _info;
+        }
+
+        /**
+         * @brief gets `iteration_info` object (constant version)
+         */
+        auto const&
+        info() const
+        {
+            return _info;
+        }
+
+        /**
+         * @brief gets array of stages of the Ith method
+         *
+         * @tparam I index of step method
+         */
+        template <std::size_t I>
+        auto&
+        stages( sub_method<I> )
+        {
+            return std::get<I>( methods ).stages();
+        }
+
+        /**
+         * @brief gets array of stages of the Ith method (constant version)
+         *
+         * @tparam I index of step method
+         */
+        template <std::size_t I>
+        auto const&
+        stages( sub_method<I> ) const
+        {
+            return std::get<I>( methods ).stages();
+        }
+    };
+
+    /**
+     * call operator to initiate composition splitting recursion
+     * @param f    \ref problem to solve
+     * @param tn   current time \f$t^n\f$
+     * @param un   current solution \f$u^n \approx u(t^n)\f$
+     * @param dt   time step \f$\Delta t\f$
+     * @param unp1 solution at time \f$t^{n+1} = t^n + \Delta t\f$
+     */
+    template <typename scheme_t, typename value_t, typename... methods_t>
+    template <typename Problem_t, typename state_t>
+    void
+    composition<scheme_t, value_t, methods_t...>::operator()( Problem_t& f, value_t& tn, state_t& un, value_t& dt, state_t& unp1 )
+    {
+        _info.reset_eval();
+
+        std::array<value_t, N_methods> times;
+        times.fill( tn );
+
+        _call_inc( f, times, un, dt, unp1 );
+
+        if constexpr ( N_steps % 2 == 0 )
+        {
+            std::swap( un, unp1 );
+        }
+
+        tn = tn + dt;
+    }
+
+    /**
+     * @brief gives a composition method with a given scheme as a template with the same parameters as other splitting methods
+     *
+     * @tparam scheme_t type which defines `steps`, `order` and `id` of the method
+     */
+    template <typename scheme_t>
+    struct composition_of
+    {
+        template <typename value_t, typename... methods_t>
+        using type = composition<scheme_t, value_t, methods_t...>;
+    };
+
+    // ---- *helper* ----
+
+    /**
+     * a helper factory for @ref ponio::splitting::detail::splitting_tuple from a tuple of algorithms to build a composition method
+     *
+     * @tparam scheme_t     type which defines `steps`, `order` and `id` of the method (for example @ref yoshida_4)
+     * @tparam value_t      type of coefficients
+     * @tparam Algorithms_t variadic list of types of algorithms
+     * @param args          variadic list of pairs of algorithm and time step
+     * @return a @ref ponio::splitting::detail::splitting_tuple object build from the tuple of methods
+     */
+    template <typename scheme_t, typename value_t, typename... Algorithms_t>
+    auto
+    make_composition_tuple( std::pair<Algorithms_t, value_t>&&... args )
+    {
+        return detail::splitting_tuple<composition_of<scheme_t>::template type, value_t, void, Algorithms_t...>(
+            std::forward_as_tuple( ( args.first )... ),
+            { args.second... } );
+    }
+
+} // namespace ponio::splitting::composition
@@ -27,22 +27,39 @@ namespace ponio::splitting::detail
      * @param ui   initial state
      * @param ti   initial time
      * @param tf   final time
-     * @param dt   time step
+     * @param dt   time step, updated with the last time step proposed by an embedded method
      * @param uip1 final state
      * @param info iteration information for sub-solver ``I``
+     *
+     * @details if `tf < ti` the sub-problem is solved backward in time (needed by composition methods with negative coefficients).
+     *
+     * An embedded method adapts its own time step inside $[t_i, t_f]$ and rejected sub-steps are computed again from the same
+     * time. The last time step is only shortened to reach `tf`, so the time step returned in `dt` is the one proposed after the last
+     * full sub-step, and the next call starts from it instead of the initial time step. For a method with a fixed time step, `dt` is
+     * unchanged.
      */
     template <std::size_t I, typename Problem_t, typename Method_t, typename state_t, typename value_t, typename iteration_info_t>
     void
-    _split_solve( Problem_t& pb, Method_t& meth, state_t& ui, value_t ti, value_t tf, value_t dt, state_t& uip1, iteration_info_t& info )
+    _split_solve( Problem_t& pb, Method_t& meth, state_t& ui, value_t ti, value_t tf, value_t& dt, state_t& uip1, iteration_info_t& info )
     {
-        value_t current_dt   = std::min( dt, tf - ti );
+        value_t const direction = ( tf < ti ) ? static_cast<value_t>( -1. ) : static_cast<value_t>( 1. );
+
+        value_t current_dt   = direction * std::min( dt, direction * ( tf - ti ) );
         value_t current_time = ti;
-        while ( current_time < tf )
+        bool is_shortened    = current_dt != direction * dt;
+        while ( direction * current_time < direction * tf )
         {
             // std::tie( current_time, ui, current_dt ) = std::get<I>( meth )( std::get<I>( pb.system ), current_time, ui, current_dt );
             std::get<I>( meth )( std::get<I>( pb.system ), current_time, ui, current_dt, uip1 );
 
-            if ( current_time + current_dt > tf )
+            // keep time step proposed after a full sub-step (a shortened one gives a too small proposal)
+            if ( !is_shortened )
+            {
+                dt = direction * current_dt;
+            }
+
+            is_shortened = direction * ( current_time + current_dt ) > direction * tf;
+            if ( is_shortened )
             {
                 current_dt = tf - current_time;
             }
@@ -55,6 +72,132 @@ namespace ponio::splitting::detail
         std::swap( ui, uip1 );
     }
 
+    /**
+     * @brief shares an error budget between sub-steps of a splitting step: each embedded method gets tolerances divided by the number of
+     * sub-steps of a splitting step, so the sum of local errors of all sub-steps remains under given tolerances
+     *
+     * @param methods     tuple of methods
+     * @param a_tol       absolute tolerance for the whole splitting step
+     * @param r_tol       relative tolerance for the whole splitting step
+     * @param n_sub_steps number of sub-steps of a splitting step (a sub-problem could be solved several times in a step, as in
+     *                    composition methods)
+     */
+    template <typename tuple_t, typename value_t>
+    void
+    share_error_budget( tuple_t& methods, value_t a_tol, value_t r_tol, std::size_t n_sub_steps )
+    {
+        std::apply(
+            [&]( auto&... meths )
+            {
+                auto share = [&]<typename method_t>( method_t& meth )
+                {
+                    if constexpr ( requires { requires method_t::is_embedded; } )
+                    {
+                        auto& info = meth.info();
+                        if constexpr ( requires { info.tolerance; } )
+                        {
+                            info.tolerance = a_tol / static_cast<value_t>( n_sub_steps );
+                        }
+                        if constexpr ( requires { info.absolute_tolerance; } )
+                        {
+                            info.absolute_tolerance = a_tol / static_cast<value_t>( n_sub_steps );
+                            info.relative_tolerance = r_tol / static_cast<value_t>( n_sub_steps );
+                        }
+                    }
+                };
+                ( share( meths ), ... );
+            },
+            methods );
+    }
+
+    /**
+     * @brief shares tolerances given to each embedded method between sub-steps of a splitting step, called when a splitting method is
+     * built: tolerances of a method are its error budget for a whole splitting step (see @ref share_error_budget)
+     *
+     * @param methods     tuple of methods
+     * @param n_sub_steps number of sub-steps of a splitting step
+     */
+    template <typename tuple_t>
+    void
+    split_error_budget( tuple_t& methods, std::size_t n_sub_steps )
+    {
+        std::apply(
+            [&]( auto&... meths )
+            {
+                auto split = [&]<typename method_t>( method_t& meth )
+                {
+                    if constexpr ( requires { requires method_t::is_embedded; } )
+                    {
+                        auto& info = meth.info();
+                        if constexpr ( requires { info.tolerance; } )
+                        {
+                            info.tolerance /= static_cast<decltype( info.tolerance )>( n_sub_steps );
+                        }
+                        if constexpr ( requires { info.absolute_tolerance; } )
+                        {
+                            info.absolute_tolerance /= static_cast<decltype( info.absolute_tolerance )>( n_sub_steps );
+                            info.relative_tolerance /= static_cast<decltype( info.relative_tolerance )>( n_sub_steps );
+                        }
+                    }
+                };
+                ( split( meths ), ... );
+            },
+            methods );
+    }
+
+    /**
+     * @brief copies the configuration of the algorithm `src` of a method (tolerances and norm of error estimate) into the algorithm
+     * `dst` of an other method
+     *
+     * @param dst algorithm to configure
+     * @param src configured algorithm
+     *
+     * @details the algorithm itself is not copied, so data kept by `dst` between two calls (as an assembled solver) is kept. The norm is
+     * copy assigned, so its vectors of tolerances and weights are only allocated again if they grow.
+     */
+    template <typename algorithm_t>
+    void
+    copy_configuration( algorithm_t& dst, algorithm_t const& src )
+    {
+        auto& dst_info       = dst.info();
+        auto const& src_info = src.info();
+
+        if constexpr ( requires { dst_info.tolerance = src_info.tolerance; } )
+        {
+            dst_info.tolerance = src_info.tolerance;
+        }
+        if constexpr ( requires { dst_info.absolute_tolerance = src_info.absolute_tolerance; } )
+        {
+            dst_info.absolute_tolerance = src_info.absolute_tolerance;
+            dst_info.relative_tolerance = src_info.relative_tolerance;
+        }
+        if constexpr ( requires { dst.norm = src.norm; } )
+        {
+            dst.norm = src.norm;
+        }
+    }
+
+    /**
+     * @brief type of state shared by a tuple of methods, `void` if it could not be deduced (for example for nested splitting methods)
+     *
+     * @tparam tuple_t type of tuple of methods
+     */
+    template <typename tuple_t>
+    struct methods_state
+    {
+        using type = void;
+    };
+
+    template <typename tuple_t>
+        requires requires { typename std::tuple_element_t<0, tuple_t>::state_type; }
+    struct methods_state<tuple_t>
+    {
+        using type = typename std::tuple_element_t<0, tuple_t>::state_type;
+    };
+
+    template <typename tuple_t>
+    using methods_state_t = typename methods_state<tuple_t>::type;
+
     // ---- class splitting_tuple ----------------------------------
 
     /** @class splitting_tuple
@@ -99,7 +242,8 @@ namespace ponio::splitting::detail
     };
 
     /**
-     * @brief factory for generic splitting method (strang, lie)
+     * @brief factory for generic splitting method (strang, lie), tolerances of embedded methods are shared between sub-steps of a
+     * splitting step (see @ref split_error_budget)
      *
      * @tparam _splitting_method_t type of splitting method
      * @tparam value_t             type of coefficients
@@ -111,11 +255,16 @@ namespace ponio::splitting::detail
     auto
     make_splitting_from_tuple( std::tuple<Methods_t...> const& meths, std::array<value_t, sizeof...( Methods_t )> const& dts )
     {
-        return _splitting_method_t<value_t, Methods_t...>( meths, dts );
+        using splitting_method_t = _splitting_method_t<value_t, Methods_t...>;
+
+        splitting_method_t splitting( meths, dts );
+        split_error_budget( splitting.methods, splitting_method_t::N_steps );
+        return splitting;
     }
 
     /**
-     * @brief factory for generic splitting method (adaptive_strang)
+     * @brief factory for generic splitting method (adaptive_strang), tolerances of embedded methods are shared between sub-steps of a
+     * splitting step (see @ref split_error_budget)
      *
      * @tparam _splitting_method_t type of splitting method
      * @tparam value_t             type of coefficients
@@ -131,12 +280,16 @@ namespace ponio::splitting::detail
         std::array<value_t, sizeof...( Methods_t )> const& dts,
         optional_tuple_t optional_args )
     {
-        return std::apply(
+        using splitting_method_t = _splitting_method_t<value_t, Methods_t...>;
+
+        auto splitting = std::apply(
             [&]<typename... Args_t>( Args_t&&... args )
             {
-                return _splitting_method_t<value_t, Methods_t...>( meths, dts, std::forward<Args_t>( args )... );
+                return splitting_method_t( meths, dts, std::forward<Args_t>( args )... );
             },
             optional_args );
+        split_error_budget( splitting.methods, splitting_method_t::N_steps );
+        return splitting;
     }
 
     // ---- class splitting_base -----------------------------------
@@ -157,7 +310,8 @@ namespace ponio::splitting::detail
         static constexpr std::size_t N_methods    = sizeof...( methods_t );
 
         tuple_t methods;
-        std::array<value_t, N_methods> time_steps;
+        std::array<value_t, N_methods> time_steps; /**< time step of each method, an embedded method carries its last one from a step to
+                                                      the next */
 
         splitting_base( std::tuple<methods_t...> const& meths, std::array<value_t, sizeof...( methods_t )> const& dts );
     };
@@ -52,6 +52,19 @@ namespace ponio::splitting::lie
         {
         }
 
+        /**
+         * @brief shares tolerances of a splitting step between embedded methods of its `N_steps` sub-steps (see @ref
+         * detail::share_error_budget)
+         *
+         * @param a_tol absolute tolerance for the whole splitting step
+         * @param r_tol relative tolerance for the whole splitting step
+         */
+        void
+        share_error_budget( value_t a_tol, value_t r_tol )
+        {
+            detail::share_error_budget( methods, a_tol, r_tol, N_steps );
+        }
+
         // _call_inc can not be outside the class definition due to llvm bug
         // (see https://github.com/llvm/llvm-project/issues/56482)
         template <std::size_t I = 0, typename Problem_t, typename state_t>
@@ -0,0 +1,395 @@
+// Copyright 2022 PONIO TEAM. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+// IWYU pragma: private
+
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <string_view> // NOLINT(misc-include-cleaner)
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../iteration_info.hpp"
+#include "../problem.hpp"
+#include "../stage.hpp"
+#include "detail.hpp"
+
+namespace ponio::splitting::mri
+{
+
+    // ---- tableaus ------------------------------------------------
+
+    /**
+     * @brief explicit MRI-GARK method of order 2 (Sandu 2019), with \f$c_2 = \frac{1}{2}\f$
+     */
+    struct mri_gark_erk22a
+    {
+        static constexpr std::size_t N_stages = 2;
+        static constexpr std::size_t N_gamma  = 1;
+        static constexpr std::size_t order    = 2;
+        static constexpr std::string_view id  = "mri_gark_erk22a";
+
+        static constexpr std::array<double, N_stages + 1> c = { 0., 0.5, 1. };
+
+        static constexpr std::array<std::array<std::array<double, N_stages>, N_stages>, N_gamma> gamma = {
+            { { { { 0.5, 0. }, { -0.5, 1. } } } }
+        };
+    };
+
+    /**
+     * @brief explicit MRI-GARK method of order 2 (Sandu 2019), with \f$c_2 = 1\f$, so its second stage does not solve the fast
+     * sub-problem
+     */
+    struct mri_gark_erk22b
+    {
+        static constexpr std::size_t N_stages = 2;
+        static constexpr std::size_t N_gamma  = 1;
+        static constexpr std::size_t order    = 2;
+        static constexpr std::string_view id  = "mri_gark_erk22b";
+
+        static constexpr std::array<double, N_stages + 1> c = { 0., 1., 1. };
+
+        static constexpr std::array<std::array<std::array<double, N_stages>, N_stages>, N_gamma> gamma = {
+            { { { { 1., 0. }, { -0.5, 0.5 } } } }
+        };
+    };
+
+    /**
+     * @brief explicit MRI-GARK method of order 3 (Sandu 2019), without fast sub-problem it is the third order method of Heun
+     */
+    struct mri_gark_erk33a
+    {
+        static constexpr std::size_t N_stages = 3;
+        static constexpr std::size_t N_gamma  = 2;
+        static constexpr std::size_t order    = 3;
+        static constexpr std::string_view id  = "mri_gark_erk33a";
+
+        static constexpr std::array<double, N_stages + 1> c = { 0., 1. / 3., 2. / 3., 1. };
+
+        static constexpr std::array<std::array<std::array<double, N_stages>, N_stages>, N_gamma> gamma = {
+            { { { { 1. / 3., 0., 0. }, { -1. / 3., 2. / 3., 0. }, { 0., -2. / 3., 1. } } },
+             { { { 0., 0., 0. }, { 0., 0., 0. }, { 0.5, 0., -0.5 } } } }
+        };
+    };
+
+    // ---- class mri_gark ------------------------------------------
+
+    /** @class mri_gark
+     *  explicit multirate infinitesimal GARK method to solve \f$\dot{u} = f^F(t, u) + f^S(t, u)\f$ where \f$f^F\f$ is the fast
+     *  sub-problem (first one in the @ref problem) and \f$f^S\f$ is the slow sub-problem (second one)
+     *  @tparam tableau_t type of tableau which defines \f$c\f$ and \f$\Gamma^k\f$ coefficients of the method
+     *  @tparam value_t   type of time steps
+     *  @tparam methods_t method to solve the fast sub-problem
+     *
+     *  @details each stage evaluates the slow sub-problem \f$f^S_i = f^S(t^n + c_i\Delta t, U_i)\f$ and solves with the method of
+     *  fast sub-problem the modified fast problem
+     *  \f[
+     *      \begin{cases}
+     *          \dot{v} = f^F(t, v) + \frac{1}{\Delta c_i}\sum_{j\leq i}\gamma_{ij}\left(\frac{t - t^n - c_i\Delta t}{\Delta c_i\Delta t}
+     *          \right)f^S_j, \quad t\in[t^n + c_i\Delta t, t^n + c_{i+1}\Delta t]\\
+     *          v(t^n + c_i\Delta t) = U_i
+     *      \end{cases}
+     *  \f]
+     *  with \f$\gamma_{ij}(\tau) = \sum_k\Gamma^k_{ij}\tau^k\f$ and \f$\Delta c_i = c_{i+1} - c_i\f$, to get \f$U_{i+1}\f$. If
+     *  \f$\Delta c_i = 0\f$ the stage is only \f$U_{i+1} = U_i + \Delta t\sum_{j\leq i}\bar{\gamma}_{ij}f^S_j\f$ with
+     *  \f$\bar{\gamma}_{ij} = \sum_k\frac{\Gamma^k_{ij}}{k+1}\f$.
+     */
+    template <typename tableau_t, typename _value_t, typename... methods_t>
+    struct mri_gark : detail::splitting_base<_value_t, methods_t...>
+    {
+        using value_t = _value_t;
+        using base_t  = detail::splitting_base<value_t, methods_t...>;
+
+        using base_t::splitting_base;
+
+        using base_t::is_splitting_method;
+        using base_t::N_methods;
+
+        using base_t::methods;
+        using base_t::time_steps;
+
+        static_assert( N_methods == 1, "MRI-GARK method needs only the method to solve fast sub-problem" );
+
+        static constexpr std::size_t order     = tableau_t::order;
+        static constexpr std::string_view id   = tableau_t::id;
+        static constexpr std::size_t N_steps   = tableau_t::N_stages;
+        static constexpr std::size_t N_buffers = tableau_t::N_stages;
+
+        using buffer_state_t = detail::methods_state_t<typename base_t::tuple_t>;
+
+        static_assert( !std::is_void_v<buffer_state_t>, "MRI-GARK method needs a state type to store evaluations of slow sub-problem" );
+
+        iteration_info<mri_gark> _info;
+        std::size_t number_of_slow_eval;        /**< number of evaluations of slow sub-problem in last step */
+        std::vector<buffer_state_t> slow_evals; /**< preallocated states \f$f^S_i\f$ */
+
+        mri_gark( std::tuple<methods_t...> const& meths, std::array<value_t, N_methods> const& dts )
+            : base_t( meths, dts )
+            , _info( methods )
+            , number_of_slow_eval( 0 )
+            , slow_evals()
+        {
+        }
+
+        /**
+         * @brief shares tolerances of a splitting step between embedded methods of its `N_steps` sub-steps (see @ref
+         * detail::share_error_budget)
+         *
+         * @param a_tol absolute tolerance for the whole splitting step
+         * @param r_tol relative tolerance for the whole splitting step
+         */
+        void
+        share_error_budget( value_t a_tol, value_t r_tol )
+        {
+            detail::share_error_budget( methods, a_tol, r_tol, N_steps );
+        }
+
+        /**
+         * @brief allocates evaluations of slow sub-problem, so that steps do not allocate any state
+         *
+         * @param shadow_of_u0 an object with the same size of computed value for allocation
+         */
+        template <typename state_t>
+        void
+        allocate_buffers( state_t const& shadow_of_u0 )
+        {
+            slow_evals.assign( N_buffers, shadow_of_u0 );
+        }
+
+        /**
+         * @brief coefficient \f$\gamma_{ij}(\tau)\f$ of the forcing term of stage `i`
+         *
+         * @tparam i index of stage
+         * @param j   index of evaluation of slow sub-problem
+         * @param tau normalized time \f$\tau\in[0, 1]\f$ in the stage
+         */
+        template <std::size_t i>
+        static value_t
+        gamma( std::size_t j, value_t tau )
+        {
+            value_t g     = static_cast<value_t>( 0. );
+            value_t tau_k = static_cast<value_t>( 1. );
+            for ( std::size_t k = 0; k < tableau_t::N_gamma; ++k )
+            {
+                g += static_cast<value_t>( tableau_t::gamma[k][i][j] ) * tau_k;
+                tau_k *= tau;
+            }
+            return g;
+        }
+
+        /**
+         * @brief coefficient \f$\bar{\gamma}_{ij} = \int_0^1\gamma_{ij}(\tau)\,\mathrm{d}\tau\f$ of stage `i`
+         *
+         * @tparam i index of stage
+         * @param j index of evaluation of slow sub-problem
+         */
+        template <std::size_t i>
+        static value_t
+        mean_gamma( std::size_t j )
+        {
+            value_t g = static_cast<value_t>( 0. );
+            for ( std::size_t k = 0; k < tableau_t::N_gamma; ++k )
+            {
+                g += static_cast<value_t>( tableau_t::gamma[k][i][j] ) / static_cast<value_t>( k + 1 );
+            }
+            return g;
+        }
+
+        /**
+         * @brief builds the modified fast problem of stage `i`, its jacobian is the one of fast sub-problem if it is given
+         *
+         * @tparam i index of stage
+         * @param f_fast fast sub-problem
+         * @param t_i    initial time of stage \f$t^n + c_i\Delta t\f$
+         * @param dt     time step \f$\Delta t\f$
+         */
+        template <std::size_t i, typename fast_problem_t>
+        auto
+        _forced_problem( fast_problem_t& f_fast, value_t t_i, value_t dt )
+        {
+            static constexpr value_t delta_c = static_cast<value_t>( tableau_t::c[i + 1] - tableau_t::c[i] );
+
+            auto forced = [&f_fast, this, t_i, dt]( value_t t, auto&& y, auto& dy ) -> void
+            {
+                f_fast( t, std::forward<decltype( y )>( y ), dy );
+
+                value_t const tau = ( t - t_i ) / ( delta_c * dt );
+                for ( std::size_t j = 0; j <= i; ++j )
+                {
+                    dy = dy + ( gamma<i>( j, tau ) / delta_c ) * slow_evals[j];
+                }
+            };
+
+            if constexpr ( requires { f_fast.df; } )
+            {
+                return ::ponio::make_problem( ::ponio::make_implicit_problem( std::move( forced ),
+                    [&f_fast]( value_t t, auto&& y )
+                    {
+                        return f_fast.df( t, std::forward<decltype( y )>( y ) );
+                    } ) );
+            }
+            else
+            {
+                return ::ponio::make_problem( ::ponio::make_simple_problem( std::move( forced ) ) );
+            }
+        }
+
+        // _call_stage can not be outside the class definition due to llvm bug
+        // (see https://github.com/llvm/llvm-project/issues/56482)
+        template <std::size_t i = 0, typename Problem_t, typename state_t>
+            requires( i == N_steps )
+        void _call_stage( Problem_t&, value_t, state_t&, value_t, state_t& )
+        {
+        }
+
+        /**
+         * @brief computes stage `i` of the method
+         *
+         * @tparam i index of stage
+         * @param f    problem to solve
+         * @param tn   current time \f$t^n\f$
+         * @param ui   stage \f$U_i\f$ (modified)
+         * @param dt   time step \f$\Delta t\f$
+         * @param uip1 stage \f$U_{i+1}\f$
+         */
+        template <std::size_t i = 0, typename Problem_t, typename state_t>
+            requires( i < N_steps )
+        void _call_stage( Problem_t& f, value_t tn, state_t& ui, value_t dt, state_t& uip1 )
+        {
+            value_t const t_i = tn + static_cast<value_t>( tableau_t::c[i] ) * dt;
+
+            f( std::integral_constant<std::size_t, 1>{}, t_i, ui, slow_evals[i] );
+            ++number_of_slow_eval;
+
+            if constexpr ( tableau_t::c[i + 1] == tableau_t::c[i] )
+            {
+                uip1 = ui + ( dt * mean_gamma<i>( 0 ) ) * slow_evals[0];
+                for ( std::size_t j = 1; j <= i; ++j )
+                {
+                    uip1 = uip1 + ( dt * mean_gamma<i>( j ) ) * slow_evals[j];
+                }
+            }
+            else
+            {
+                auto forced_pb = _forced_problem<i>( std::get<0>( f.system ), t_i, dt );
+
+                value_t const t_ip1 = tn + static_cast<value_t>( tableau_t::c[i + 1] ) * dt;
+                detail::_split_solve<0>( forced_pb, methods, ui, t_i, t_ip1, time_steps[0], uip1, _info );
+            }
+
+            _call_stage<i + 1>( f, tn, uip1, dt, ui );
+        }
+
+        template <typename Problem_t, typename state_t>
+        void
+        operator()( Problem_t& f, value_t& tn, state_t& un, value_t& dt, state_t& unp1 );
+
+        /**
+         * @brief gets `iteration_info` object
+         */
+        auto&
+        info()
+        {
+            return _info;
+        }
+
+        /**
+         * @brief gets `iteration_info` object (constant version)
+         */
+        auto const&
+        info() const
+        {
+            return _info;
+        }
+
+        /**
+         * @brief gets array of stages of the method of fast sub-problem
+         */
+        auto&
+        stages( sub_method<0> )
+        {
+            return std::get<0>( methods ).stages();
+        }
+
+        /**
+         * @brief gets array of stages of the method of fast sub-problem (constant version)
+         */
+        auto const&
+        stages( sub_method<0> ) const
+        {
+            return std::get<0>( methods ).stages();
+        }
+    };
+
+    /**
+     * call operator to initiate MRI-GARK stages recursion
+     * @param f    \ref problem to solve, first sub-problem is the fast one and second sub-problem is the slow one
+     * @param tn   current time \f$t^n\f$
+     * @param un   current solution \f$u^n \approx u(t^n)\f$
+     * @param dt   time step \f$\Delta t\f$
+     * @param unp1 solution at time \f$t^{n+1} = t^n + \Delta t\f$
+     */
+    template <typename tableau_t, typename value_t, typename... methods_t>
+    template <typename Problem_t, typename state_t>
+    void
+    mri_gark<tableau_t, value_t, methods_t...>::operator()( Problem_t& f, value_t& tn, state_t& un, value_t& dt, state_t& unp1 )
+    {
+        _info.reset_eval();
+        number_of_slow_eval = 0;
+
+        // states are allocated at construction (or on first call)
+        if ( slow_evals.empty() )
+        {
+            allocate_buffers( un );
+        }
+
+        _call_stage( f, tn, un, dt, unp1 );
+
+        if constexpr ( N_steps % 2 == 0 )
+        {
+            std::swap( un, unp1 );
+        }
+
+        tn = tn + dt;
+    }
+
+    /**
+     * @brief gives a MRI-GARK method with a given tableau as a template with the same parameters as other splitting methods
+     *
+     * @tparam tableau_t type of tableau of the method
+     */
+    template <typename tableau_t>
+    struct mri_gark_of
+    {
+        template <typename value_t, typename... methods_t>
+        using type = mri_gark<tableau_t, value_t, methods_t...>;
+    };
+
+    // ---- *helper* ----
+
+    /**
+     * a helper factory for @ref ponio::splitting::detail::splitting_tuple from the algorithm of fast sub-problem to build a MRI-GARK
+     * method
+     *
+     * @tparam tableau_t   type of tableau of the method (for example @ref mri_gark_erk33a)
+     * @tparam value_t     type of coefficients
+     * @tparam Algorithm_t type of algorithm to solve fast sub-problem
+     * @param fast_algo    pair of algorithm and time step to solve fast sub-problem
+     * @return a @ref ponio::splitting::detail::splitting_tuple object build from the method of fast sub-problem
+     */
+    template <typename tableau_t, typename value_t, typename Algorithm_t>
+    auto
+    make_mri_gark_tuple( std::pair<Algorithm_t, value_t>&& fast_algo )
+    {
+        return detail::splitting_tuple<mri_gark_of<tableau_t>::template type, value_t, void, Algorithm_t>(
+            std::tuple<Algorithm_t>( std::move( fast_algo.first ) ),
+            { fast_algo.second } );
+    }
+
+} // namespace ponio::splitting::mri
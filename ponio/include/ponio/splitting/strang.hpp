@@ -6,14 +6,19 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <concepts>
 #include <cstddef>
+#include <memory>
 #include <string_view> // NOLINT(misc-include-cleaner)
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
+#include "../concurrency.hpp"
 #include "../detail.hpp" // NOLINT(misc-include-cleaner)
 #include "../iteration_info.hpp"
 #include "../ponio_config.hpp"
@@ -55,6 +60,19 @@ namespace ponio::splitting::strang
         {
         }
 
+        /**
+         * @brief shares tolerances of a splitting step between embedded methods of its `N_steps` sub-steps (see @ref
+         * detail::share_error_budget)
+         *
+         * @param a_tol absolute tolerance for the whole splitting step
+         * @param r_tol relative tolerance for the whole splitting step
+         */
+        void
+        share_error_budget( value_t a_tol, value_t r_tol )
+        {
+            detail::share_error_budget( methods, a_tol, r_tol, N_steps );
+        }
+
         // end of incremental recursion, start of decremental recursion
         // _call_inc can not be outside the class definition due to llvm bug
         // (see https://github.com/llvm/llvm-project/issues/56482)
@@ -238,93 +256,226 @@ namespace ponio::splitting::strang
         static constexpr std::size_t N_steps = 2 * N_methods - 1;
         static constexpr bool is_embedded    = true;
 
+        static constexpr std::size_t N_buffers = 4;
+
+        using buffer_state_t = detail::methods_state_t<typename base_t::tuple_t>;
+        using buffer_t       = std::conditional_t<std::is_void_v<buffer_state_t>, bool, std::vector<buffer_state_t>>;
+
         iteration_info<adaptive_strang> _info;
+        bool parallel_sweeps;                                  /**< computes reference and shifted solutions concurrently */
+        std::shared_ptr<::ponio::detail::worker_pool> workers; /**< thread of shifted solution, only with `parallel_sweeps` */
+        typename base_t::tuple_t methods_shift;                /**< methods to compute shifted solution, synced with `methods` */
+        std::array<value_t, N_methods> time_steps_shift;       /**< time steps of methods to compute shifted solution */
+        iteration_info<adaptive_strang> _info_shift;           /**< evaluations made to compute shifted solution */
+        buffer_t buffers; /**< preallocated states: \f$u^n\f$ for each solution, shifted solution \f$u^{n+1}_\delta\f$ and one more for
+                             Lipschitz constant estimate */
 
         adaptive_strang( std::tuple<methods_t...> const& meths,
             std::array<value_t, N_methods> const& dts,
             value_t delta,
-            value_t tol = default_config::tol )
+            value_t tol           = default_config::tol,
+            bool parallel_sweeps_ = false )
             : base_t( meths, dts )
             , _info( methods, delta, tol )
+            , parallel_sweeps( parallel_sweeps_ )
+            , workers( parallel_sweeps_ ? std::make_shared<::ponio::detail::worker_pool>( 1 ) : nullptr )
+            , methods_shift( meths )
+            , time_steps_shift( dts )
+            , _info_shift( methods_shift, delta, tol )
+            , buffers()
         {
         }
 
-        template <std::size_t I = 0, typename Problem_t, typename state_t>
+        /**
+         * @brief allocates temporary states used at each step, so that next steps do not allocate any state
+         *
+         * @param shadow_of_u0 an object with the same size of computed value for allocation
+         */
+        template <typename state_t>
+        void
+        allocate_buffers( state_t const& shadow_of_u0 )
+        {
+            if constexpr ( std::same_as<buffer_t, std::vector<state_t>> )
+            {
+                buffers.assign( N_buffers, shadow_of_u0 );
+            }
+        }
+
+        /**
+         * @brief shares tolerances of a splitting step between embedded methods of its `N_steps` sub-steps, for reference and shifted
+         * solutions
+         *
+         * @param a_tol absolute tolerance for the whole splitting step
+         * @param r_tol relative tolerance for the whole splitting step
+         */
+        void
+        share_error_budget( value_t a_tol, value_t r_tol )
+        {
+            detail::share_error_budget( methods, a_tol, r_tol, N_steps );
+            detail::share_error_budget( methods_shift, a_tol, r_tol, N_steps );
+        }
+
+        /**
+         * @brief copies configuration of methods of `methods` (tolerances and options) into `methods_shift`
+         *
+         * @details `methods` is the only tuple of methods to configure: this is called before each step so both solutions are computed
+         * with the same sub-methods. Only the configuration is copied, each method keeps its own stages and data kept between steps.
+         */
+        void
+        sync_shifted_methods()
+        {
+            [&]<std::size_t... Is>( std::index_sequence<Is...> )
+            {
+                ( detail::copy_configuration( std::get<Is>( methods_shift ).alg, std::get<Is>( methods ).alg ), ... );
+            }( std::make_index_sequence<N_methods>{} );
+        }
+
+        template <std::size_t I = 0, typename tuple_t, typename Problem_t, typename state_t>
             requires( I == N_methods - 1 )
-        void _call_inc( Problem_t& f, value_t tn, state_t& ui, value_t dt, value_t shift, state_t& uip1 )
+        void _call_inc( tuple_t& meths,
+            iteration_info<adaptive_strang>& info,
+            std::array<value_t, N_methods>& dts,
+            Problem_t& f,
+            value_t tn,
+            state_t& ui,
+            value_t dt,
+            value_t shift,
+            state_t& uip1 )
         {
-            // ui = detail::_split_solve<I>( f, methods, ui, tn, tn + dt, time_steps[I], _info );
-            detail::_split_solve<I>( f, methods, ui, tn, tn + dt, time_steps[I], uip1, _info );
-            _call_dec<I - 1>( f, tn, uip1, dt, shift, ui );
+            detail::_split_solve<I>( f, meths, ui, tn, tn + dt, dts[I], uip1, info );
+            _call_dec<I - 1>( meths, info, dts, f, tn, uip1, dt, shift, ui );
         }
 
-        template <std::size_t I = 0, typename Problem_t, typename state_t>
+        template <std::size_t I = 0, typename tuple_t, typename Problem_t, typename state_t>
             requires( 0 < I && I < N_methods - 1 )
-        void _call_inc( Problem_t& f, value_t tn, state_t& ui, value_t dt, value_t shift, state_t& uip1 )
+        void _call_inc( tuple_t& meths,
+            iteration_info<adaptive_strang>& info,
+            std::array<value_t, N_methods>& dts,
+            Problem_t& f,
+            value_t tn,
+            state_t& ui,
+            value_t dt,
+            value_t shift,
+            state_t& uip1 )
         {
-            // ui = detail::_split_solve<I>( f, methods, ui, tn, tn + 0.5 * dt, time_steps[I], _info );
-            detail::_split_solve<I>( f, methods, ui, tn, tn + 0.5 * dt, time_steps[I], uip1, _info );
-            _call_inc<I + 1>( f, tn, uip1, dt, shift, ui );
+            detail::_split_solve<I>( f, meths, ui, tn, tn + 0.5 * dt, dts[I], uip1, info );
+            _call_inc<I + 1>( meths, info, dts, f, tn, uip1, dt, shift, ui );
         }
 
-        template <std::size_t I = 0, typename Problem_t, typename state_t>
+        template <std::size_t I = 0, typename tuple_t, typename Problem_t, typename state_t>
             requires( I == 0 )
-        void _call_inc( Problem_t& f, value_t tn, state_t& ui, value_t dt, value_t shift, state_t& uip1 )
+        void _call_inc( tuple_t& meths,
+            iteration_info<adaptive_strang>& info,
+            std::array<value_t, N_methods>& dts,
+            Problem_t& f,
+            value_t tn,
+            state_t& ui,
+            value_t dt,
+            value_t shift,
+            state_t& uip1 )
         {
-            // ui = detail::_split_solve<I>( f, methods, ui, tn, tn + ( 0.5 + shift ) * dt, time_steps[I], _info );
-            detail::_split_solve<I>( f, methods, ui, tn, tn + ( 0.5 + shift ) * dt, time_steps[I], uip1, _info );
-            _call_inc<I + 1>( f, tn, uip1, dt, shift, ui );
+            detail::_split_solve<I>( f, meths, ui, tn, tn + ( 0.5 + shift ) * dt, dts[I], uip1, info );
+            _call_inc<I + 1>( meths, info, dts, f, tn, uip1, dt, shift, ui );
         }
 
-        template <std::size_t I = N_methods - 1, typename Problem_t, typename state_t>
+        template <std::size_t I = N_methods - 1, typename tuple_t, typename Problem_t, typename state_t>
             requires( I > 0 )
-        void _call_dec( Problem_t& f, value_t tn, state_t& ui, value_t dt, value_t shift, state_t& uip1 )
+        void _call_dec( tuple_t& meths,
+            iteration_info<adaptive_strang>& info,
+            std::array<value_t, N_methods>& dts,
+            Problem_t& f,
+            value_t tn,
+            state_t& ui,
+            value_t dt,
+            value_t shift,
+            state_t& uip1 )
         {
-            // ui = detail::_split_solve<I>( f, methods, ui, tn + 0.5 * dt, tn + dt, time_steps[I], _info );
-            detail::_split_solve<I>( f, methods, ui, tn + 0.5 * dt, tn + dt, time_steps[I], uip1, _info );
-            _call_dec<I - 1>( f, tn, uip1, dt, shift, ui );
+            detail::_split_solve<I>( f, meths, ui, tn + 0.5 * dt, tn + dt, dts[I], uip1, info );
+            _call_dec<I - 1>( meths, info, dts, f, tn, uip1, dt, shift, ui );
         }
 
-        template <std::size_t I = N_methods - 1, typename Problem_t, typename state_t>
+        template <std::size_t I = N_methods - 1, typename tuple_t, typename Problem_t, typename state_t>
             requires( I == 0 )
-        void _call_dec( Problem_t& f, value_t tn, state_t& ui, value_t dt, value_t shift, state_t& uip1 )
+        void _call_dec( tuple_t& meths,
+            iteration_info<adaptive_strang>& info,
+            std::array<value_t, N_methods>& dts,
+            Problem_t& f,
+            value_t tn,
+            state_t& ui,
+            value_t dt,
+            value_t shift,
+            state_t& uip1 )
         {
-            // ui = detail::_split_solve<I>( f, methods, ui, tn + ( 0.5 + shift ) * dt, tn + dt, time_steps[I], _info );
-            detail::_split_solve<I>( f, methods, ui, tn + ( 0.5 + shift ) * dt, tn + dt, time_steps[I], uip1, _info );
+            detail::_split_solve<I>( f, meths, ui, tn + ( 0.5 + shift ) * dt, tn + dt, dts[I], uip1, info );
         }
 
         /**
-         * call operator to initiate adaptive Strang splitting recursion
-         * @param f     \ref problem to solve
-         * @param tn    current time \f$t^n\f$
-         * @param un    current solution \f$u^n \approx u(t^n)\f$
-         * @param dt    time step \f$\Delta t\f$
-         * @param u_np1 solution at time \f$t^{n+1} = t^n + \Delta t\f$
+         * @brief computes reference solution \f$\mathcal{S}^{\Delta t}u^n\f$ in `u_np1` and shifted solution \f$\mathcal{S}_\delta^{\Delta
+         * t}u^n\f$ in `u_np1_shift`
+         *
+         * @param f           \ref problem to solve
+         * @param tn          current time \f$t^n\f$
+         * @param u_n         copy of \f$u^n\f$ for reference solution (modified)
+         * @param u_n_shift   copy of \f$u^n\f$ for shifted solution (modified)
+         * @param dt          time step \f$\Delta t\f$
+         * @param u_np1       reference solution
+         * @param u_np1_shift shifted solution
+         *
+         * @details the shifted solution is computed with its own copy of methods, so with `parallel_sweeps` both solutions are computed
+         * concurrently (the shifted one on the thread of `workers`), each sub-problem of `f` should be safely callable from two threads.
          */
         template <typename Problem_t, typename state_t>
         void
-        operator()( Problem_t& f, value_t& tn, state_t& un, value_t& dt, state_t& u_np1 )
+        _sweeps( Problem_t& f, value_t tn, state_t& u_n, state_t& u_n_shift, value_t dt, state_t& u_np1, state_t& u_np1_shift )
         {
-            _info.reset_eval();
+            _info_shift.reset_eval();
 
-            // state_t u_np1_ref   = un;
-            state_t u_n         = un;
-            state_t u_n_shift   = un;
-            state_t u_np1_shift = un;
+            auto sweep = [&]( std::size_t i )
+            {
+                if ( i == 0 )
+                {
+                    _call_inc( methods, _info, time_steps, f, tn, u_n, dt, 0., u_np1 );
+                }
+                else
+                {
+                    _call_inc( methods_shift, _info_shift, time_steps_shift, f, tn, u_n_shift, dt, _info.delta, u_np1_shift );
+                }
+            };
 
-            // TODO: launch _call_inc in parallel
-            // j'ai voulu lancer chacune de ces 2 fonctions dans des threads différents
-            // avec std::thread
-            // mais j'ai eu une erreur, donc à corriger plus tard
-            //_call_inc( f, tn, u_np1_ref, dt, 0. );
+            if ( parallel_sweeps )
+            {
+                if ( workers == nullptr )
+                {
+                    workers = std::make_shared<::ponio::detail::worker_pool>( 1 );
+                }
+                workers->parallel_for( 2, sweep );
+            }
+            else
+            {
+                sweep( 0 );
+                sweep( 1 );
+            }
 
-            _call_inc( f, tn, u_n, dt, 0., u_np1 );
-            _call_inc( f, tn, u_n_shift, dt, _info.delta, u_np1_shift );
+            _info.increment( _info_shift );
+        }
 
+        /**
+         * @brief computes error between reference and shifted solutions, and next time step
+         *
+         * @param tn          current time \f$t^n\f$
+         * @param un          current solution \f$u^n \approx u(t^n)\f$
+         * @param dt          time step \f$\Delta t\f$
+         * @param u_np1       reference solution
+         * @param u_np1_shift shifted solution
+         */
+        template <typename state_t>
+        void
+        _step_control( value_t& tn, state_t& un, value_t& dt, state_t& u_np1, state_t const& u_np1_shift )
+        {
             _info.error = ::ponio::detail::error_estimate( un, u_np1, u_np1_shift, info().tolerance, static_cast<value_t>( 1.0 ) );
 
             value_t new_dt = 0.9 * std::sqrt( info().tolerance / _info.error ) * dt;
-            new_dt         = std::min( std::max( 0.2 * dt, new_dt ), 5. * dt );
+            new_dt         = ::ponio::detail::clamp_time_step( new_dt, dt );
 
             _info.success = _info.error < static_cast<value_t>( 1.0 );
 
@@ -345,6 +496,49 @@ namespace ponio::splitting::strang
             }
         }
 
+        /**
+         * call operator to initiate adaptive Strang splitting recursion
+         * @param f     \ref problem to solve
+         * @param tn    current time \f$t^n\f$
+         * @param un    current solution \f$u^n \approx u(t^n)\f$
+         * @param dt    time step \f$\Delta t\f$
+         * @param u_np1 solution at time \f$t^{n+1} = t^n + \Delta t\f$
+         */
+        template <typename Problem_t, typename state_t>
+        void
+        operator()( Problem_t& f, value_t& tn, state_t& un, value_t& dt, state_t& u_np1 )
+        {
+            _info.reset_eval();
+            sync_shifted_methods();
+
+            if constexpr ( std::same_as<buffer_t, std::vector<state_t>> )
+            {
+                // states are allocated at construction (or on first call), then only copied
+                if ( buffers.empty() )
+                {
+                    allocate_buffers( un );
+                }
+                auto& u_n         = buffers[0];
+                auto& u_n_shift   = buffers[1];
+                auto& u_np1_shift = buffers[2];
+
+                u_n       = un;
+                u_n_shift = un;
+
+                _sweeps( f, tn, u_n, u_n_shift, dt, u_np1, u_np1_shift );
+                _step_control( tn, un, dt, u_np1, u_np1_shift );
+            }
+            else
+            {
+                state_t u_n         = un;
+                state_t u_n_shift   = un;
+                state_t u_np1_shift = un;
+
+                _sweeps( f, tn, u_n, u_n_shift, dt, u_np1, u_np1_shift );
+                _step_control( tn, un, dt, u_np1, u_np1_shift );
+            }
+        }
+
         /**
          * @brief estimate Lipschitz constant of problem \f$f\f$ at time \f$t^n\f$
          *
@@ -416,29 +610,52 @@ namespace ponio::splitting::strang
             static constexpr value_t b2 = 0.4;
             static constexpr value_t c2 = 0.1;
 
-            state_t u_n      = un;
-            state_t u_np1_a  = un;
-            state_t u_tmp_bc = un;
-            state_t u_np1_bc = un;
-
-            auto local_error = [&]( value_t a, value_t b, value_t c )
+            auto local_error = [&]( state_t& u_n, state_t& u_np1_a, state_t& u_tmp_bc, state_t& u_np1_bc, value_t a, value_t b, value_t c )
             {
                 u_n = un;
                 // compute strang(tn, un, a*dt)
-                _call_inc<0>( f, tn, u_n, a * dt, 0., u_np1_a );
+                _call_inc<0>( methods, _info, time_steps, f, tn, u_n, a * dt, 0., u_np1_a );
 
                 u_n = un;
                 // compute strang(tn+c*dt, strang(tn, un, c*dt), b*dt )
-                _call_inc<0>( f, tn, u_n, c * dt, 0., u_tmp_bc );
-                _call_inc<0>( f, tn + c * dt, u_tmp_bc, b * dt, 0., u_np1_bc );
+                _call_inc<0>( methods, _info, time_steps, f, tn, u_n, c * dt, 0., u_tmp_bc );
+                _call_inc<0>( methods, _info, time_steps, f, tn + c * dt, u_tmp_bc, b * dt, 0., u_np1_bc );
+
+                // u_tmp_bc is not needed anymore, reuse it to store the difference
+                u_tmp_bc = u_np1_a - u_np1_bc;
+                return ::ponio::detail::norm( u_tmp_bc );
+            };
 
-                return ::ponio::detail::norm( static_cast<state_t>( u_np1_a - u_np1_bc ) );
+            auto local_errors = [&]( state_t& u_n, state_t& u_np1_a, state_t& u_tmp_bc, state_t& u_np1_bc )
+            {
+                // e1 = || S_{a1*dt}(un) - S_{b1*dt}(S_{c1*dt}(un)) ||
+                // e2 = || S_{a2*dt}(un) - S_{b2*dt}(S_{c2*dt}(un)) ||
+                return std::make_pair( local_error( u_n, u_np1_a, u_tmp_bc, u_np1_bc, a1, b1, c1 ),
+                    local_error( u_n, u_np1_a, u_tmp_bc, u_np1_bc, a2, b2, c2 ) );
             };
 
-            // e1 = || S_{a1*dt}(un) - S_{b1*dt}(S_{c1*dt}(un)) ||
-            // e2 = || S_{a2*dt}(un) - S_{b2*dt}(S_{c2*dt}(un)) ||
-            auto e1 = local_error( a1, b1, c1 );
-            auto e2 = local_error( a2, b2, c2 );
+            auto errors = [&]()
+            {
+                if constexpr ( std::same_as<buffer_t, std::vector<state_t>> )
+                {
+                    if ( buffers.empty() )
+                    {
+                        allocate_buffers( un );
+                    }
+                    return local_errors( buffers[0], buffers[1], buffers[2], buffers[3] );
+                }
+                else
+                {
+                    state_t u_n      = un;
+                    state_t u_np1_a  = un;
+                    state_t u_tmp_bc = un;
+                    state_t u_np1_bc = un;
+
+                    return local_errors( u_n, u_np1_a, u_tmp_bc, u_np1_bc );
+                }
+            }();
+            auto e1 = errors.first;
+            auto e2 = errors.second;
 
             // we have:
             // || e1 - (a1**3 - b1**3)C0 dt**3 || <= w C0 c1**3 dt**3
@@ -531,10 +748,33 @@ namespace ponio::splitting::strang
     auto
     make_adaptive_strang_tuple( value_t delta, value_t tol, std::pair<Algorithms_t, value_t>&&... args )
     {
-        return detail::splitting_tuple<adaptive_strang, value_t, std::tuple<value_t, value_t>, Algorithms_t...>(
+        return detail::splitting_tuple<adaptive_strang, value_t, std::tuple<value_t, value_t, bool>, Algorithms_t...>(
+            std::forward_as_tuple( ( args.first )... ),
+            { args.second... },
+            std::make_tuple( delta, tol, false ) );
+    }
+
+    /**
+     * a helper factory for @ref ponio::splitting::detail::splitting_tuple from a tuple of algorithms to build an adaptive time step Strang
+     * method which computes reference and shifted solutions concurrently
+     *
+     * @tparam value_t      type of coefficients
+     * @tparam Algorithms_t variadic list of types of algorithms
+     * @param delta     shift argument
+     * @param tol       tolerance for adaptive time step algorithm
+     * @param args      variadic list of pairs of algorithm and time step
+     * @return a @ref ponio::splitting::detail::splitting_tuple object build from the tuple of methods
+     *
+     * @warning each sub-problem is called from two threads at the same time, so it should not modify a shared state.
+     */
+    template <typename value_t, typename... Algorithms_t>
+    auto
+    make_parallel_adaptive_strang_tuple( value_t delta, value_t tol, std::pair<Algorithms_t, value_t>&&... args )
+    {
+        return detail::splitting_tuple<adaptive_strang, value_t, std::tuple<value_t, value_t, bool>, Algorithms_t...>(
             std::forward_as_tuple( ( args.first )... ),
             { args.second... },
-            std::make_tuple( delta, tol ) );
+            std::make_tuple( delta, tol, true ) );
     }
 
 } // namespace ponio::splitting::strang
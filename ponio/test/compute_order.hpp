@@ -26,6 +26,7 @@ using namespace std::string_literals;
 
 #include <ponio/detail.hpp>
 #include <ponio/problem.hpp>
+#include <ponio/runge_kutta.hpp>
 #include <ponio/solver.hpp>
 #include <ponio/time_span.hpp>
 
@@ -546,6 +547,47 @@ namespace splitting_method
         return long_time_check_order( algo );
     }
 
+    template <typename Algorithm_t, typename T = double>
+    auto
+    finite_time_check_order( Algorithm_t& algo )
+    {
+        // compare to a reference solution of the whole Lotka-Volterra problem (for high order methods where long time invariant error
+        // saturates)
+        using state_t = std::valarray<T>;
+
+        T alpha = 2. / 3.;
+        T beta  = 4. / 3.;
+        T gamma = 1.;
+        T delta = 1.;
+
+        auto pb     = make_lotka_volterra_problem<2>( alpha, beta, gamma, delta );
+        auto pb_ref = ponio::make_simple_problem(
+            [=]( T, state_t const& u, state_t& du )
+            {
+                du[0] = alpha * u[0] - beta * u[0] * u[1];
+                du[1] = delta * u[0] * u[1] - gamma * u[1];
+            } );
+
+        T x0          = 1.9;
+        state_t u_ini = { x0, x0 };
+
+        ponio::time_span<T> t_span = { 0., 10. };
+        state_t u_ref = ::ponio::solve( pb_ref, ponio::runge_kutta::rk_44(), u_ini, t_span, 1e-4, []( T, state_t const&, T ) {} );
+
+        std::vector<T> dts = { 0.2, 0.1, 0.05, 0.025 };
+        std::vector<T> errors;
+        std::vector<T> log_dts;
+
+        for ( auto dt : dts )
+        {
+            state_t u_end = ::ponio::solve( pb, algo, u_ini, t_span, dt, []( T, state_t const&, T ) {} );
+            errors.push_back( std::log10( std::abs( u_end - u_ref ).max() ) );
+            log_dts.push_back( std::log10( dt ) );
+        }
+
+        return mayor_method( log_dts, errors );
+    }
+
     template <std::size_t I, typename splitting_tuple_t, typename T = double>
     auto
     check_order_split_solve( splitting_tuple_t split_tuple = splitting_tuple_t() )
@@ -577,7 +619,8 @@ namespace splitting_method
             T y0 = 1.0;
             T y1 = 0.0;
 
-            ponio::splitting::detail::_split_solve<I>( pb, split_tuple.methods, y0, t0, t1, dt, y1, split_tuple.info() );
+            T sub_dt = dt;
+            ponio::splitting::detail::_split_solve<I>( pb, split_tuple.methods, y0, t0, t1, sub_dt, y1, split_tuple.info() );
 
             auto e = error( y_exa, y1 );
             errors.push_back( std::log( e ) );
@@ -2,13 +2,23 @@
 // Use of this source code is governed by a BSD-style
 // license that can be found in the LICENSE file.
 
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <cmath>
+#include <cstddef>
+#include <functional>
 #include <numeric>
+#include <stdexcept>
 #include <valarray>
 #include <vector>
 
+#include <ponio/concurrency.hpp>
 #include <ponio/detail.hpp>
+#include <ponio/error_norm.hpp>
+#include <ponio/problem.hpp>
+#include <ponio/runge_kutta.hpp>
+#include <ponio/solver.hpp>
 
 TEST_CASE( "detail::power" )
 {
@@ -160,3 +170,209 @@ TEST_CASE( "detail::tpl_inner_product::vector" )
         }
     }
 }
+
+TEST_CASE( "detail::pairwise_sum" )
+{
+    std::array<int, 7> const a = { 1, 2, 3, 4, 5, 6, 7 };
+    std::array<int, 7> const b = { 7, 6, 5, 4, 3, 2, 1 };
+
+    auto product = []( int ai, int bi )
+    {
+        return ai * bi;
+    };
+
+    CHECK( ponio::detail::pairwise_sum<0, 7>( a, b, product ) == std::inner_product( a.begin(), a.end(), b.begin(), 0 ) );
+    CHECK( ponio::detail::pairwise_sum<2, 3>( a, b, product ) == 3 * 5 + 4 * 4 + 5 * 3 );
+}
+
+TEST_CASE( "detail::compensated_sum" )
+{
+    // sum of 10^6 time steps in single precision
+    std::size_t const n = 1'000'000;
+    float const dt      = 1e-3f;
+
+    ponio::detail::compensated_sum<float> time_sum;
+    time_sum.reset( 0.f );
+
+    float naive_time = 0.f;
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        naive_time += dt;
+        time_sum.add( dt );
+    }
+
+    double const exact_time = static_cast<double>( n ) * static_cast<double>( dt );
+
+    CHECK( std::abs( static_cast<double>( time_sum.sum ) - exact_time ) < 1e-4 );
+    CHECK( std::abs( static_cast<double>( time_sum.sum ) - exact_time ) < std::abs( static_cast<double>( naive_time ) - exact_time ) );
+
+    CHECK( time_sum.reset( 2.f ) == 2.f );
+    CHECK( time_sum.compensation == 0.f );
+}
+
+TEST_CASE( "detail::worker_pool" )
+{
+    ponio::detail::worker_pool pool( 3 );
+    CHECK( pool.size() == 3 );
+
+    SUBCASE( "all tasks are done" )
+    {
+        std::vector<int> done( 100, 0 );
+        for ( int n = 0; n < 10; ++n )
+        {
+            pool.parallel_for( done.size(),
+                [&]( std::size_t i )
+                {
+                    ++done[i];
+                } );
+        }
+        CHECK( std::ranges::all_of( done,
+            []( int d )
+            {
+                return d == 10;
+            } ) );
+    }
+
+    SUBCASE( "nested loop" )
+    {
+        // a loop submitted from a task of the running loop is executed on the calling thread
+        std::vector<int> done( 16, 0 );
+        pool.parallel_for( 4,
+            [&]( std::size_t i )
+            {
+                pool.parallel_for( 4,
+                    [&]( std::size_t j )
+                    {
+                        ++done[4 * i + j];
+                    } );
+            } );
+        CHECK( std::ranges::all_of( done,
+            []( int d )
+            {
+                return d == 1;
+            } ) );
+    }
+
+    SUBCASE( "exception" )
+    {
+        std::atomic<int> n_calls = 0;
+        CHECK_THROWS_AS( pool.parallel_for( 8,
+                             [&]( std::size_t i )
+                             {
+                                 ++n_calls;
+                                 if ( i == 5 )
+                                 {
+                                     throw std::runtime_error( "task 5" );
+                                 }
+                             } ),
+            std::runtime_error );
+        CHECK( n_calls == 8 );
+    }
+}
+
+#if defined( PONIO_USE_COMPENSATED_SUM )
+TEST_CASE( "detail::compensated_sum::solver" )
+{
+    // time of each iteration of a long integration in single precision
+    auto pb = ponio::make_simple_problem(
+        []( float, float y )
+        {
+            return -y;
+        } );
+
+    float const dt                       = 1e-3f;
+    ponio::time_span<float> const t_span = { 0.f, 50.f, 100.f };
+
+    auto sol_range = ponio::make_solver_range( pb, ponio::runge_kutta::rk_33_t<float>(), 1.f, t_span, dt );
+
+    std::size_t n    = 0;
+    double max_drift = 0.;
+    for ( auto it_sol = sol_range.begin(); it_sol != sol_range.end(); ++it_sol, ++n )
+    {
+        max_drift = std::max( max_drift, std::abs( static_cast<double>( it_sol->time ) - static_cast<double>( n ) * 1e-3 ) );
+    }
+
+    CHECK( n == 100'001 );
+    CHECK( max_drift < 1e-4 );
+}
+#endif
+
+// state distributed on two processes which own the same elements, with a counter of global reductions
+struct mirrored_state : std::vector<double>
+{
+    using std::vector<double>::vector;
+
+    static inline std::size_t n_reductions = 0;
+};
+
+template <>
+struct ponio::global_reduction<mirrored_state>
+{
+    template <typename value_t>
+    static value_t
+    sum( mirrored_state const&, value_t local )
+    {
+        ++mirrored_state::n_reductions;
+        return 2 * local;
+    }
+
+    template <typename value_t>
+    static value_t
+    max( mirrored_state const&, value_t local )
+    {
+        ++mirrored_state::n_reductions;
+        return local;
+    }
+};
+
+TEST_CASE( "detail::global_reduction" )
+{
+    std::size_t const n = 23;
+    std::vector<double> un( n ), unp1( n ), unp1bis( n );
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        un[i]      = std::sin( static_cast<double>( i ) );
+        unp1[i]    = un[i] + 1e-3 * std::cos( static_cast<double>( i ) );
+        unp1bis[i] = unp1[i] + 1e-7 * static_cast<double>( i );
+    }
+    mirrored_state m_un( un.begin(), un.end() ), m_unp1( unp1.begin(), unp1.end() ), m_unp1bis( unp1bis.begin(), unp1bis.end() );
+
+    double const a_tol = 1e-6;
+    double const r_tol = 1e-5;
+
+    SUBCASE( "norms" )
+    {
+        mirrored_state::n_reductions = 0;
+
+        // sum of squares is doubled
+        CHECK( ponio::detail::norm( m_un ) == doctest::Approx( std::sqrt( 2. ) * ponio::detail::norm( un ) ) );
+        CHECK( ponio::runge_kutta::rock::detail::norm_2( m_un )
+               == doctest::Approx( std::sqrt( 2. ) * ponio::runge_kutta::rock::detail::norm_2( un ) ) );
+        CHECK( mirrored_state::n_reductions == 2 );
+    }
+
+    SUBCASE( "error estimates" )
+    {
+        mirrored_state::n_reductions = 0;
+
+        // means are unchanged, number of elements is reduced too
+        double const error = ponio::detail::error_estimate( un, unp1, unp1bis, a_tol, r_tol );
+        CHECK( ponio::detail::error_estimate( m_un, m_unp1, m_unp1bis, a_tol, r_tol ) == doctest::Approx( error ) );
+        CHECK( mirrored_state::n_reductions == 2 );
+
+        auto max_norm = ponio::error_norm::make_weighted_norm<ponio::error_norm::max>();
+        CHECK( max_norm( m_un, m_unp1, m_unp1bis, a_tol, r_tol ) == doctest::Approx( max_norm( un, unp1, unp1bis, a_tol, r_tol ) ) );
+        CHECK( mirrored_state::n_reductions == 4 );
+
+        // fused error estimate of the last stage of an embedded method
+        std::array<double, 1> b = { 1. };
+        std::array<mirrored_state, 1> k;
+        k[0] = mirrored_state( n );
+        std::ranges::transform( unp1bis, un, k[0].begin(), std::minus<>() );
+        mirrored_state m_out( n );
+
+        double const fused_error = ponio::detail::tpl_inner_product_and_error<1>( b, k, m_un, 1., m_out, m_unp1, a_tol, r_tol );
+        CHECK( fused_error == doctest::Approx( error ) );
+        CHECK( mirrored_state::n_reductions == 6 );
+    }
+}
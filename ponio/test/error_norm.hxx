@@ -0,0 +1,180 @@
+// Copyright 2022 PONIO TEAM. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include <ponio/detail.hpp>
+#include <ponio/error_norm.hpp>
+#include <ponio/method.hpp>
+#include <ponio/runge_kutta.hpp>
+
+namespace error_norm_test
+{
+    struct states
+    {
+        std::vector<double> un;
+        std::vector<double> unp1;
+        std::vector<double> unp1bis;
+
+        explicit states( std::size_t n )
+            : un( n )
+            , unp1( n )
+            , unp1bis( n )
+        {
+            for ( std::size_t i = 0; i < n; ++i )
+            {
+                un[i]      = std::sin( static_cast<double>( i ) );
+                unp1[i]    = un[i] + 0.1 * std::cos( static_cast<double>( i ) );
+                unp1bis[i] = unp1[i] + 1e-4 * std::sin( 3. * static_cast<double>( i ) );
+            }
+        }
+
+        // scaled error with group tolerances of component i (reference computation)
+        double
+        x( std::size_t i, double a_tol, double r_tol, double w = 1. ) const
+        {
+            return w * std::abs( unp1[i] - unp1bis[i] ) / ( a_tol + r_tol * std::max( std::abs( un[i] ), std::abs( unp1[i] ) ) );
+        }
+    };
+} // namespace error_norm_test
+
+TEST_CASE( "error_norm::default" )
+{
+    error_norm_test::states s( 27 );
+
+    ponio::error_norm::weighted_norm<> norm;
+
+    CHECK( norm.is_default() );
+    CHECK( norm( s.un, s.unp1, s.unp1bis, 1e-5, 1e-4 )
+           == doctest::Approx( ponio::detail::error_estimate( s.un, s.unp1, s.unp1bis, 1e-5, 1e-4 ) ) );
+    CHECK( norm( 1., 1.5, 1.5001, 1e-5, 1e-4 ) == doctest::Approx( ponio::detail::error_estimate( 1., 1.5, 1.5001, 1e-5, 1e-4 ) ) );
+}
+
+TEST_CASE( "error_norm::kinds" )
+{
+    error_norm_test::states s( 27 );
+
+    double r_max = 0.;
+    double r_l1  = 0.;
+    for ( std::size_t i = 0; i < s.un.size(); ++i )
+    {
+        r_max = std::max( r_max, s.x( i, 1e-5, 1e-4 ) );
+        r_l1 += s.x( i, 1e-5, 1e-4 );
+    }
+    r_l1 /= static_cast<double>( s.un.size() );
+
+    auto norm_max = ponio::error_norm::make_weighted_norm<ponio::error_norm::max>();
+    auto norm_l1  = ponio::error_norm::make_weighted_norm<ponio::error_norm::l1>();
+
+    CHECK( !norm_max.is_default() );
+    CHECK( norm_max( s.un, s.unp1, s.unp1bis, 1e-5, 1e-4 ) == doctest::Approx( r_max ) );
+    CHECK( norm_l1( s.un, s.unp1, s.unp1bis, 1e-5, 1e-4 ) == doctest::Approx( r_l1 ) );
+}
+
+TEST_CASE( "error_norm::groups" )
+{
+    // 3 groups and an incomplete last group
+    error_norm_test::states s( 3 * 9 + 2 );
+
+    std::vector<double> const a_tol = { 1e-6, 1e-4, 1e-8 };
+    std::vector<double> const w     = { 1., 0.5, 2. };
+
+    SUBCASE( "vector absolute tolerance and scalar relative tolerance" )
+    {
+        double r = 0.;
+        for ( std::size_t i = 0; i < s.un.size(); ++i )
+        {
+            r += s.x( i, a_tol[i % 3], 1e-3 ) * s.x( i, a_tol[i % 3], 1e-3 );
+        }
+        r = std::sqrt( r / static_cast<double>( s.un.size() ) );
+
+        auto norm = ponio::error_norm::make_weighted_norm( a_tol );
+
+        CHECK( norm.n_groups() == 3 );
+        CHECK( !norm.is_default() );
+        CHECK( norm( s.un, s.unp1, s.unp1bis, 1., 1e-3 ) == doctest::Approx( r ) );
+    }
+
+    SUBCASE( "weights of groups and max norm" )
+    {
+        double r = 0.;
+        for ( std::size_t i = 0; i < s.un.size(); ++i )
+        {
+            r = std::max( r, s.x( i, 1e-5, a_tol[i % 3], w[i % 3] ) );
+        }
+
+        auto norm = ponio::error_norm::make_weighted_norm<ponio::error_norm::max>( {}, a_tol, w );
+
+        CHECK( norm( s.un, s.unp1, s.unp1bis, 1e-5, 1. ) == doctest::Approx( r ) );
+    }
+
+    SUBCASE( "tolerances of each component" )
+    {
+        std::vector<double> a_tol_i( s.un.size() );
+        double r = 0.;
+        for ( std::size_t i = 0; i < s.un.size(); ++i )
+        {
+            a_tol_i[i] = 1e-6 * static_cast<double>( i + 1 );
+            r += s.x( i, a_tol_i[i], 1e-4 );
+        }
+        r /= static_cast<double>( s.un.size() );
+
+        auto norm = ponio::error_norm::make_weighted_norm<ponio::error_norm::l1>( a_tol_i, { 1e-4 } );
+
+        CHECK( norm( s.un, s.unp1, s.unp1bis, 1., 1. ) == doctest::Approx( r ) );
+    }
+}
+
+TEST_CASE( "error_norm::sizes" )
+{
+    using ponio::error_norm::make_weighted_norm;
+
+    // each vector is empty, of size 1 or of size the number of groups
+    CHECK( make_weighted_norm( { 1e-6, 1e-4, 1e-8 }, { 1e-3 }, {} ).has_valid_sizes() );
+    CHECK( make_weighted_norm( {}, { 1e-3, 1e-4 }, { 1., 2. } ).has_valid_sizes() );
+
+    // a vector of an other size would be read out of bounds
+    CHECK_THROWS_AS( make_weighted_norm( { 1e-6, 1e-4, 1e-8 }, { 1e-3, 1e-4 } ), std::invalid_argument );
+    CHECK_THROWS_AS( make_weighted_norm( { 1e-6, 1e-4 }, { 1e-3 }, { 1., 2., 3., 4. } ), std::invalid_argument );
+
+    ponio::error_norm::weighted_norm<> norm{ { 1e-6, 1e-4, 1e-8 }, {}, { 1., 2. } };
+    CHECK( !norm.has_valid_sizes() );
+}
+
+TEST_CASE( "error_norm::explicit_runge_kutta" )
+{
+    using state_t = std::vector<double>;
+
+    auto f = []( double, state_t const& u, state_t& du )
+    {
+        for ( std::size_t i = 0; i < u.size(); ++i )
+        {
+            du[i] = -static_cast<double>( i + 1 ) * u[i];
+        }
+    };
+
+    auto norm = ponio::error_norm::make_weighted_norm<ponio::error_norm::max>( { 1e-8, 1e-6 } );
+    auto algo = ponio::runge_kutta::rk54_6m().abs_tol( 1e-5 ).rel_tol( 1e-4 ).error_norm( norm );
+
+    CHECK( algo.info().absolute_tolerance == 1e-5 );
+    CHECK( algo.info().relative_tolerance == 1e-4 );
+
+    state_t un( 10, 1. ), unp1( 10 );
+    auto meth = ponio::make_method<double>( algo, un );
+
+    double tn = 0.;
+    double dt = 1e-3;
+    meth( f, tn, un, dt, unp1 );
+
+    REQUIRE( meth.info().success );
+    CHECK( meth.info().error == doctest::Approx( norm( un, unp1, meth.kis[decltype( algo )::N_stages + 1], 1e-5, 1e-4 ) ) );
+}
@@ -2,11 +2,23 @@
 // Use of this source code is governed by a BSD-style
 // license that can be found in the LICENSE file.
 
+#include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstddef>
 #include <span>
+#include <type_traits>
+#include <valarray>
 #include <vector>
 
+#include <ponio/detail.hpp>
 #include <ponio/expressions/state.hpp>
+#include <ponio/ponio_config.hpp>
+
+#if __has_include( <eigen3/Eigen/Dense>) || __has_include( <Eigen/Dense>)
+#include <ponio/expressions/eigen.hpp>
+#define PONIO_TEST_EIGEN_EXPRESSIONS
+#endif
 
 /*
 
@@ -957,3 +969,238 @@ TEST_CASE( "expressions::span::expr3.3" )
         CHECK( r1[i] == result[i] );
     }
 }
+
+/////////////////////////////////////////////////////////////////////
+// tests on a large state (parallel assignment if ponio is compiled with `PONIO_USE_OPENMP` or `PONIO_USE_PARALLEL_STL`)
+
+TEST_CASE( "expressions::large_vector" )
+{
+    using container_t = std::vector<double>;
+    using namespace ponio::expression;
+
+    std::size_t const n = 4 * ponio::default_config::parallel_assignment_threshold + 3;
+
+    container_t a( n ), b( n ), r( n );
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        a[i] = static_cast<double>( i );
+        b[i] = static_cast<double>( n - i );
+    }
+
+    make_state( r ) = make_state( a ) + make_scalar( 2. ) * make_state( b );
+
+    bool all_equal = true;
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        all_equal = all_equal && ( r[i] == static_cast<double>( i ) + 2. * static_cast<double>( n - i ) );
+    }
+    CHECK( all_equal );
+
+    // r_i = 2n - i
+    CHECK( reduce( max_norm( make_state( r ) ) ) == 2. * static_cast<double>( n ) );
+    auto r_max = make_state( r ).assign_and_reduce( make_state( a ) - make_state( b ), max_norm( make_state( r ) ) );
+    CHECK( r_max == static_cast<double>( n ) );
+}
+
+TEST_CASE( "expressions::chunk_size" )
+{
+    using ponio::expression::detail::chunk_size;
+
+    // 8 doubles per cache line of 64 bytes
+    CHECK( chunk_size<double>( 100, 4 ) == 32 );
+    CHECK( chunk_size<double>( 64, 4 ) == 16 );
+    CHECK( chunk_size<double>( 3, 4 ) == 8 );
+    CHECK( chunk_size<float>( 100, 1 ) == 112 );
+}
+
+TEST_CASE( "expressions::simd_assignment" )
+{
+    using namespace ponio::expression;
+
+    // unaligned destination and odd size to test first and last elements computed one by one
+    std::vector<double> raw_a( 104 ), raw_b( 104 ), raw_r( 104, 0. );
+    for ( std::size_t i = 0; i < raw_a.size(); ++i )
+    {
+        raw_a[i] = static_cast<double>( i );
+        raw_b[i] = 0.5 * static_cast<double>( i );
+    }
+
+    std::span<double> a( raw_a.data() + 1, 101 ), b( raw_b.data() + 1, 101 ), r( raw_r.data() + 1, 101 );
+
+    auto expr = -make_state( a ) + make_scalar( 3. ) * make_state( b ) / make_scalar( 2. ) - make_state( a ) * make_state( b );
+
+#if defined( PONIO_USE_SIMD )
+    static_assert( detail::is_simd_loadable<decltype( expr ), detail::native_simd<double>> );
+#endif
+
+    make_state( r ) = expr;
+
+    CHECK( raw_r[0] == 0. );
+    CHECK( raw_r[102] == 0. );
+    for ( std::size_t i = 0; i < r.size(); ++i )
+    {
+        CHECK( r[i] == doctest::Approx( -a[i] + 3. * b[i] / 2. - a[i] * b[i] ) );
+    }
+}
+
+TEST_CASE( "expressions::reductions" )
+{
+    using namespace ponio::expression;
+
+    std::vector<double> a( 1001 ), b( 1001 );
+    for ( std::size_t i = 0; i < a.size(); ++i )
+    {
+        a[i] = std::sin( static_cast<double>( i ) );
+        b[i] = 1. + 0.5 * std::cos( static_cast<double>( i ) );
+    }
+
+    double dot_ref = 0., max_ref = 0., rms_ref = 0.;
+    for ( std::size_t i = 0; i < a.size(); ++i )
+    {
+        dot_ref += a[i] * b[i];
+        max_ref = std::max( max_ref, std::abs( a[i] - b[i] ) );
+        rms_ref += ( a[i] / ( 0.1 + 0.2 * b[i] ) ) * ( a[i] / ( 0.1 + 0.2 * b[i] ) );
+    }
+    rms_ref = std::sqrt( rms_ref / static_cast<double>( a.size() ) );
+
+    CHECK( reduce( dot( make_state( a ), make_state( b ) ) ) == doctest::Approx( dot_ref ) );
+    CHECK( reduce( max_norm( make_state( a ) - make_state( b ) ) ) == doctest::Approx( max_ref ) );
+    auto rms = reduce( weighted_rms( make_state( a ), make_scalar( 0.1 ) + make_scalar( 0.2 ) * make_state( b ) ) );
+    CHECK( rms == doctest::Approx( rms_ref ) );
+}
+
+TEST_CASE( "expressions::assign_and_reduce" )
+{
+    using namespace ponio::expression;
+
+    // unaligned destination and odd size to test first and last elements computed one by one
+    std::vector<double> raw_a( 104 ), raw_b( 104 ), raw_r( 104, 0. );
+    for ( std::size_t i = 0; i < raw_a.size(); ++i )
+    {
+        raw_a[i] = std::sin( static_cast<double>( i ) );
+        raw_b[i] = std::cos( static_cast<double>( i ) );
+    }
+
+    std::span<double> a( raw_a.data() + 1, 101 ), b( raw_b.data() + 1, 101 ), r( raw_r.data() + 1, 101 );
+
+    auto expr = make_state( a ) + make_scalar( 0.5 ) * make_state( b );
+
+    double r_max = make_state( r ).assign_and_reduce( expr, max_norm( make_state( r ) ) );
+
+    CHECK( raw_r[0] == 0. );
+    CHECK( raw_r[102] == 0. );
+    for ( std::size_t i = 0; i < r.size(); ++i )
+    {
+        CHECK( r[i] == doctest::Approx( a[i] + 0.5 * b[i] ) );
+    }
+    CHECK( r_max == doctest::Approx( reduce( max_norm( make_state( r ) ) ) ) );
+
+    // error estimate of an embedded method computed with the assignment of the solution
+    std::vector<double> un( raw_a.begin(), raw_a.end() ), unp1( un.size() ), unp1bis( un.size() );
+    for ( std::size_t i = 0; i < un.size(); ++i )
+    {
+        unp1bis[i] = un[i] + 0.01 * raw_b[i];
+    }
+    double const a_tol = 1e-4;
+    double const r_tol = 1e-3;
+
+    double err = make_state( unp1 ).assign_and_reduce( make_state( un ) + make_scalar( 0.01 ) * make_state( raw_b ) + make_scalar( 1e-5 ),
+        weighted_rms( make_state( unp1 ) - make_state( unp1bis ),
+            make_scalar( a_tol ) + make_scalar( r_tol ) * ponio::expression::max( abs( make_state( un ) ), abs( make_state( unp1 ) ) ) ) );
+
+    CHECK( err == doctest::Approx( ponio::detail::error_estimate( un, unp1, unp1bis, a_tol, r_tol ) ) );
+}
+
+TEST_CASE( "expressions::use_expression" )
+{
+    using namespace ponio::expression;
+
+    static_assert( use_expression_v<std::vector<double>> );
+    static_assert( use_expression_v<std::valarray<double> const> );
+    static_assert( use_expression_v<std::span<float>> );
+    static_assert( !use_expression_v<double> );
+    static_assert( !use_expression_v<std::array<double, 3>> );
+
+    // linear combination of stages of `std::valarray` is computed with ponio expressions (valarray operators are not used)
+    static_assert( !ponio::detail::tpl_inner_product_requirement<std::valarray<double>,
+                   double,
+                   std::array<double, 3>,
+                   std::array<std::valarray<double>, 3>> );
+
+    std::size_t const n = 67;
+    std::valarray<double> un( n ), unp1( n );
+    std::array<std::valarray<double>, 3> k = { std::valarray<double>( n ), std::valarray<double>( n ), std::valarray<double>( n ) };
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        un[i]   = std::sin( static_cast<double>( i ) );
+        k[0][i] = static_cast<double>( i );
+        k[1][i] = std::cos( static_cast<double>( i ) );
+        k[2][i] = 1. / static_cast<double>( i + 1 );
+    }
+    std::array<double, 3> b = { 0.25, 0.5, 0.25 };
+    double dt               = 0.1;
+
+    ponio::detail::tpl_inner_product<3>( b, k, un, dt, unp1 );
+
+    std::valarray<double> expected = un + dt * ( b[0] * k[0] + b[1] * k[1] + b[2] * k[2] );
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        CHECK( unp1[i] == doctest::Approx( expected[i] ) );
+    }
+}
+
+#if defined( PONIO_HAS_MDSPAN )
+TEST_CASE( "expressions::mdspan" )
+{
+    using namespace ponio::expression;
+
+    // a 2D field is assigned with a flat index on its contiguous storage
+    std::vector<double> raw_a( 7 * 9 ), raw_b( 7 * 9 ), raw_r( 7 * 9 );
+    for ( std::size_t i = 0; i < raw_a.size(); ++i )
+    {
+        raw_a[i] = static_cast<double>( i );
+        raw_b[i] = 2. * static_cast<double>( i );
+    }
+
+    std::mdspan a( raw_a.data(), 7, 9 ), b( raw_b.data(), 7, 9 ), r( raw_r.data(), 7, 9 );
+    static_assert( use_expression_v<decltype( a )> );
+
+    make_state( r ) = make_state( a ) + make_scalar( 0.5 ) * make_state( b );
+
+    for ( std::size_t i = 0; i < raw_r.size(); ++i )
+    {
+        CHECK( raw_r[i] == doctest::Approx( 2. * raw_a[i] ) );
+    }
+}
+#endif
+
+#if defined( PONIO_TEST_EIGEN_EXPRESSIONS )
+TEST_CASE( "expressions::eigen_map" )
+{
+    using namespace ponio::expression;
+
+    std::vector<double> raw_a( 101 ), raw_b( 101 ), raw_r( 101, 0. );
+    for ( std::size_t i = 0; i < raw_a.size(); ++i )
+    {
+        raw_a[i] = static_cast<double>( i );
+        raw_b[i] = std::sin( static_cast<double>( i ) );
+    }
+
+    Eigen::Map<Eigen::VectorXd> a( raw_a.data(), 101 ), b( raw_b.data(), 101 ), r( raw_r.data(), 101 );
+    static_assert( use_expression_v<decltype( a )> );
+    static_assert( !use_expression_v<Eigen::Map<Eigen::VectorXd, 0, Eigen::InnerStride<2>>> );
+
+    auto expr = make_state( a ) - make_scalar( 3. ) * make_state( b );
+#if defined( PONIO_USE_SIMD )
+    static_assert( detail::is_simd_loadable<decltype( expr ), detail::native_simd<double>> );
+#endif
+
+    make_state( r ) = expr;
+
+    CHECK( make_state( r ).size() == 101 );
+    for ( std::size_t i = 0; i < raw_r.size(); ++i )
+    {
+        CHECK( raw_r[i] == doctest::Approx( raw_a[i] - 3. * raw_b[i] ) );
+    }
+}
+#endif
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cmath>
 
 #include <doctest/doctest.h>
@@ -13,6 +14,11 @@
 #include <ponio/solver.hpp>
 #include <ponio/splitting.hpp>
 
+#if __has_include( <eigen3/Eigen/Dense>) || __has_include( <Eigen/Dense>)
+#include <ponio/eigen_linear_algebra.hpp>
+#define PONIO_TEST_EIGEN_SHAMPINE
+#endif
+
 /**
  * In this test case we solve the Curtiss and Hirschfelder problem:
  *
@@ -249,6 +255,50 @@ TEST_CASE( "number_of_eval::rock2" )
     CHECK( cumulative_counter == manual_counter );
 }
 
+TEST_CASE( "number_of_eval::parallel_iterated_runge_kutta" )
+{
+    std::atomic<std::size_t> manual_counter = 0;
+
+    double const k            = 50;
+    auto curtiss_hirschfelder = ponio::make_simple_problem(
+        [&, k]( double t, double y, double& dy )
+        {
+            ++manual_counter;
+            dy = k * ( std::cos( t ) - y );
+        } );
+
+    double const y_0 = 2.0;
+
+    ponio::time_span<double> const t_span = { 0., 2. };
+    double const dt                       = 0.01;
+
+    auto sequential_range = ponio::make_solver_range( curtiss_hirschfelder, ponio::runge_kutta::pirk_radau_5(), y_0, t_span, dt );
+    auto concurrent_range = ponio::make_solver_range( curtiss_hirschfelder, ponio::runge_kutta::pirk_radau_5( true ), y_0, t_span, dt );
+    auto it_seq           = sequential_range.begin();
+    auto it_con           = concurrent_range.begin();
+
+    // stages are evaluated on a pool of threads created once
+    CHECK( it_seq.meth.alg.scheduler.workers == nullptr );
+    auto const* workers_ptr = it_con.meth.alg.scheduler.workers.get();
+    REQUIRE( workers_ptr != nullptr );
+    CHECK( workers_ptr->size() == 2 );
+
+    std::size_t cumulative_counter = 0;
+    while ( it_seq->time < t_span.back() )
+    {
+        ++it_seq;
+        ++it_con;
+        cumulative_counter += it_seq.info().number_of_eval + it_con.info().number_of_eval;
+
+        // concurrent evaluation of stages doesn't change the result
+        CHECK( it_con->state == it_seq->state );
+        CHECK( it_con.meth.alg.scheduler.workers.get() == workers_ptr );
+    }
+
+    CHECK( it_seq.info().number_of_eval == 13 );
+    CHECK( cumulative_counter == manual_counter );
+}
+
 TEST_CASE( "number_of_eval::rock4" )
 {
     std::size_t manual_counter = 0;
@@ -340,6 +390,209 @@ TEST_CASE( "number_of_eval::pirock" )
     CHECK( cumulative_counter_ex == manual_counter_ex );
 }
 
+/**
+ * Same problem solved with embedded PIROCK method, the error estimator uses Shampine's trick on scalar Jacobian `df_im`, so the time step
+ * is adapted.
+ */
+TEST_CASE( "number_of_eval::pirock_shampine" )
+{
+    std::size_t manual_counter_im = 0;
+    std::size_t manual_counter_ex = 0;
+
+    double const k = 50;
+    auto f_im      = ponio::make_simple_problem(
+        [&]( double, double y, double& dy )
+        {
+            ++manual_counter_im;
+            dy = -k * y;
+        } );
+    auto df_im = [&]( double, double )
+    {
+        return -k;
+    };
+    auto f_ex = ponio::make_simple_problem(
+        [&, k]( double t, double, double& dy )
+        {
+            ++manual_counter_ex;
+            dy = k * std::cos( t );
+        } );
+
+    double const y_0 = 2.0;
+
+    ponio::time_span<double> const t_span = { 0., 2. };
+    double const dt                       = 0.05;
+
+    auto eig_computer = [=]( auto&, double, auto&, double, auto& )
+    {
+        return k;
+    };
+
+    auto curtiss_hirschfelder = ponio::make_imex_jacobian_problem( f_ex, f_im, df_im );
+    auto pirock_embedded      = ponio::runge_kutta::pirock::pirock<1, true>( ponio::runge_kutta::pirock::beta_0<double>(),
+        eig_computer,
+        ponio::shampine_trick::shampine_trick<double>() );
+    auto sol_range            = ponio::make_solver_range( curtiss_hirschfelder, pirock_embedded, y_0, t_span, dt );
+    auto it_sol               = sol_range.begin();
+
+    std::size_t cumulative_counter_ex = 0;
+    std::size_t cumulative_counter_im = 0;
+    bool is_adapted                   = false;
+    while ( it_sol->time < t_span.back() )
+    {
+        ++it_sol;
+        cumulative_counter_ex += std::get<0>( it_sol.info().number_of_eval );
+        cumulative_counter_im += std::get<1>( it_sol.info().number_of_eval );
+
+        is_adapted = is_adapted || ( it_sol->time_step != doctest::Approx( dt ) );
+    }
+
+    CHECK( cumulative_counter_im == manual_counter_im );
+    CHECK( cumulative_counter_ex == manual_counter_ex );
+    CHECK( is_adapted );
+    CHECK( it_sol->state == doctest::Approx( 2500. / 2501. * std::cos( 2. ) + 50. / 2501. * std::sin( 2. ) ).epsilon( 1e-3 ) );
+}
+
+#if defined( PONIO_TEST_EIGEN_SHAMPINE )
+/**
+ * Same problem with two components \f$y_0\f$ and \f$y_1\f$ (with \f$k_0 = 50\f$ and \f$k_1 = 25\f$) stored in an Eigen vector, the error
+ * estimator uses Shampine's trick with the LU factorization of the dense Jacobian `df_im`.
+ */
+TEST_CASE( "number_of_eval::pirock_shampine_eigen_dense" )
+{
+    using state_t    = Eigen::Vector2d;
+    using jacobian_t = Eigen::Matrix2d;
+
+    std::size_t manual_counter_im = 0;
+    std::size_t manual_counter_ex = 0;
+
+    state_t const k = { 50., 25. };
+    auto f_im       = ponio::make_simple_problem(
+        [&]( double, state_t const& y, state_t& dy )
+        {
+            ++manual_counter_im;
+            dy = -k.cwiseProduct( y );
+        } );
+    auto df_im = [&]( double, state_t const& )
+    {
+        jacobian_t J = ( -k ).asDiagonal();
+        return J;
+    };
+    auto f_ex = ponio::make_simple_problem(
+        [&]( double t, state_t const&, state_t& dy )
+        {
+            ++manual_counter_ex;
+            dy = k * std::cos( t );
+        } );
+
+    state_t const y_0 = { 2., 2. };
+
+    ponio::time_span<double> const t_span = { 0., 2. };
+    double const dt                       = 0.05;
+
+    auto eig_computer = [&]( auto&, double, auto&, double, auto& )
+    {
+        return k.maxCoeff();
+    };
+
+    auto curtiss_hirschfelder = ponio::make_imex_jacobian_problem( f_ex, f_im, df_im );
+    auto pirock_embedded      = ponio::runge_kutta::pirock::pirock<1, true>( ponio::runge_kutta::pirock::beta_0<double>(),
+        eig_computer,
+        ponio::shampine_trick::shampine_trick<jacobian_t>() );
+    auto sol_range            = ponio::make_solver_range( curtiss_hirschfelder, pirock_embedded, y_0, t_span, dt );
+    auto it_sol               = sol_range.begin();
+
+    std::size_t cumulative_counter_ex = 0;
+    std::size_t cumulative_counter_im = 0;
+    bool is_adapted                   = false;
+    while ( it_sol->time < t_span.back() )
+    {
+        ++it_sol;
+        cumulative_counter_ex += std::get<0>( it_sol.info().number_of_eval );
+        cumulative_counter_im += std::get<1>( it_sol.info().number_of_eval );
+
+        is_adapted = is_adapted || ( it_sol->time_step != doctest::Approx( dt ) );
+    }
+
+    CHECK( cumulative_counter_im == manual_counter_im );
+    CHECK( cumulative_counter_ex == manual_counter_ex );
+    CHECK( is_adapted );
+    CHECK( it_sol->state[0] == doctest::Approx( 2500. / 2501. * std::cos( 2. ) + 50. / 2501. * std::sin( 2. ) ).epsilon( 1e-3 ) );
+    CHECK( it_sol->state[1] == doctest::Approx( 625. / 626. * std::cos( 2. ) + 25. / 626. * std::sin( 2. ) ).epsilon( 1e-3 ) );
+}
+
+/**
+ * Same problem with two components stored in an Eigen vector of dynamic size, the error estimator uses Shampine's trick with the sparse
+ * LU factorization of the sparse Jacobian `df_im`.
+ */
+TEST_CASE( "number_of_eval::pirock_shampine_eigen_sparse" )
+{
+    using state_t    = Eigen::VectorXd;
+    using jacobian_t = Eigen::SparseMatrix<double>;
+
+    std::size_t manual_counter_im = 0;
+    std::size_t manual_counter_ex = 0;
+
+    state_t k( 2 );
+    k << 50., 25.;
+    auto f_im = ponio::make_simple_problem(
+        [&]( double, state_t const& y, state_t& dy )
+        {
+            ++manual_counter_im;
+            dy = -k.cwiseProduct( y );
+        } );
+    auto df_im = [&]( double, state_t const& )
+    {
+        jacobian_t J( k.size(), k.size() );
+        for ( Eigen::Index i = 0; i < k.size(); ++i )
+        {
+            J.insert( i, i ) = -k[i];
+        }
+        return J;
+    };
+    auto f_ex = ponio::make_simple_problem(
+        [&]( double t, state_t const&, state_t& dy )
+        {
+            ++manual_counter_ex;
+            dy = k * std::cos( t );
+        } );
+
+    state_t const y_0 = state_t::Constant( 2, 2. );
+
+    ponio::time_span<double> const t_span = { 0., 2. };
+    double const dt                       = 0.05;
+
+    auto eig_computer = [&]( auto&, double, auto&, double, auto& )
+    {
+        return k.maxCoeff();
+    };
+
+    auto curtiss_hirschfelder = ponio::make_imex_jacobian_problem( f_ex, f_im, df_im );
+    auto pirock_embedded      = ponio::runge_kutta::pirock::pirock<1, true>( ponio::runge_kutta::pirock::beta_0<double>(),
+        eig_computer,
+        ponio::shampine_trick::shampine_trick<jacobian_t>() );
+    auto sol_range            = ponio::make_solver_range( curtiss_hirschfelder, pirock_embedded, y_0, t_span, dt );
+    auto it_sol               = sol_range.begin();
+
+    std::size_t cumulative_counter_ex = 0;
+    std::size_t cumulative_counter_im = 0;
+    bool is_adapted                   = false;
+    while ( it_sol->time < t_span.back() )
+    {
+        ++it_sol;
+        cumulative_counter_ex += std::get<0>( it_sol.info().number_of_eval );
+        cumulative_counter_im += std::get<1>( it_sol.info().number_of_eval );
+
+        is_adapted = is_adapted || ( it_sol->time_step != doctest::Approx( dt ) );
+    }
+
+    CHECK( cumulative_counter_im == manual_counter_im );
+    CHECK( cumulative_counter_ex == manual_counter_ex );
+    CHECK( is_adapted );
+    CHECK( it_sol->state[0] == doctest::Approx( 2500. / 2501. * std::cos( 2. ) + 50. / 2501. * std::sin( 2. ) ).epsilon( 1e-3 ) );
+    CHECK( it_sol->state[1] == doctest::Approx( 625. / 626. * std::cos( 2. ) + 25. / 626. * std::sin( 2. ) ).epsilon( 1e-3 ) );
+}
+#endif
+
 /**
  * ----------------------------------------------------------------------------
  *
@@ -446,6 +699,135 @@ TEST_CASE( "number_of_eval::splitting_strang" )
     CHECK( cumulative_counter_2 == manual_counter_2 );
 }
 
+TEST_CASE( "number_of_eval::splitting_embedded_sub_method" )
+{
+    double const k = 50;
+
+    auto f1 = ponio::make_simple_problem(
+        [&]( double, double y )
+        {
+            return -k * y;
+        } );
+    auto f2 = ponio::make_simple_problem(
+        [&, k]( double t, double )
+        {
+            return k * std::cos( t );
+        } );
+
+    double const y_0 = 2.0;
+
+    ponio::time_span<double> const t_span = { 0., 2. };
+    double const dt                       = 0.05;
+    double const initial_sub_dt           = 1e-6;
+
+    auto curtiss_hirschfelder = ponio::make_problem( f1, f2 );
+    auto strang               = ponio::splitting::make_strang_tuple(
+        std::make_pair( ponio::runge_kutta::rk54_6m().abs_tol( 1e-6 ).rel_tol( 1e-6 ), initial_sub_dt ),
+        std::make_pair( ponio::runge_kutta::rk_33(), 0.25 * dt ) );
+    auto sol_range = ponio::make_solver_range( curtiss_hirschfelder, strang, y_0, t_span, dt );
+    auto it_sol    = sol_range.begin();
+
+    // tolerances given to embedded method are shared between the 3 sub-steps of a Strang step when splitting is built
+    CHECK( it_sol.meth.info().get( std::integral_constant<std::size_t, 0>{} ).absolute_tolerance == doctest::Approx( 1e-6 / 3. ) );
+    CHECK( it_sol.meth.info().get( std::integral_constant<std::size_t, 0>{} ).relative_tolerance == doctest::Approx( 1e-6 / 3. ) );
+
+    it_sol.meth.share_error_budget( 1e-6, 1e-6 );
+    CHECK( it_sol.meth.info().get( std::integral_constant<std::size_t, 0>{} ).absolute_tolerance == doctest::Approx( 1e-6 / 3. ) );
+
+    ++it_sol;
+    std::size_t const first_step_evals = std::get<0>( it_sol.info().number_of_eval );
+
+    // time step of embedded method is carried from a step to the next one, fixed time step method keeps its own
+    CHECK( it_sol.meth.time_steps[0] > 10. * initial_sub_dt );
+    CHECK( it_sol.meth.time_steps[1] == 0.25 * dt );
+
+    ++it_sol;
+    std::size_t const second_step_evals = std::get<0>( it_sol.info().number_of_eval );
+
+    CHECK( second_step_evals < first_step_evals );
+
+    while ( it_sol->time < t_span.back() )
+    {
+        ++it_sol;
+    }
+
+    // same splitting with a fixed small time step for stiff sub-problem
+    auto strang_ref    = ponio::splitting::make_strang_tuple( std::make_pair( ponio::runge_kutta::rk_44(), 1e-4 ),
+        std::make_pair( ponio::runge_kutta::rk_33(), 0.25 * dt ) );
+    auto sol_range_ref = ponio::make_solver_range( curtiss_hirschfelder, strang_ref, y_0, t_span, dt );
+    auto it_sol_ref    = sol_range_ref.begin();
+    while ( it_sol_ref->time < t_span.back() )
+    {
+        ++it_sol_ref;
+    }
+
+    CHECK( it_sol->time == doctest::Approx( it_sol_ref->time ) );
+    CHECK( it_sol->state == doctest::Approx( it_sol_ref->state ).epsilon( 1e-5 ) );
+}
+
+TEST_CASE( "number_of_eval::composition_embedded_sub_method" )
+{
+    double const k = 50;
+
+    auto f1 = ponio::make_simple_problem(
+        [&]( double, double y )
+        {
+            return -k * y;
+        } );
+    auto f2 = ponio::make_simple_problem(
+        [&, k]( double t, double )
+        {
+            return k * std::cos( t );
+        } );
+
+    double const y_0 = 2.0;
+
+    ponio::time_span<double> const t_span = { 0., 1. };
+    double const dt                       = 0.05;
+
+    auto curtiss_hirschfelder = ponio::make_problem( f1, f2 );
+
+    // schemes with negative coefficients solve some sub-problems backward in time, so an embedded method works with negative time steps
+    auto check_composition = [&]<typename scheme_t>( scheme_t )
+    {
+        auto composition = ponio::splitting::make_composition_tuple<scheme_t>(
+            std::make_pair( ponio::runge_kutta::rk54_6m().abs_tol( 1e-8 ).rel_tol( 1e-8 ), 0.5 ),
+            std::make_pair( ponio::runge_kutta::rk_33(), 0.25 * dt ) );
+        auto sol_range = ponio::make_solver_range( curtiss_hirschfelder, composition, y_0, t_span, dt );
+        auto it_sol    = sol_range.begin();
+
+        // tolerances are shared between all sub-steps of a composition step, not only between both sub-problems
+        static constexpr std::size_t N_steps = decltype( it_sol.meth )::N_steps;
+        CHECK( std::get<0>( it_sol.meth.methods ).info().absolute_tolerance == doctest::Approx( 1e-8 / static_cast<double>( N_steps ) ) );
+
+        std::size_t n_steps = 0;
+        while ( it_sol->time < t_span.back() && n_steps < 1000 )
+        {
+            ++it_sol;
+            ++n_steps;
+        }
+
+        auto composition_ref = ponio::splitting::make_composition_tuple<scheme_t>( std::make_pair( ponio::runge_kutta::rk_44(), 1e-4 ),
+            std::make_pair( ponio::runge_kutta::rk_33(), 0.25 * dt ) );
+        auto sol_range_ref   = ponio::make_solver_range( curtiss_hirschfelder, composition_ref, y_0, t_span, dt );
+        auto it_sol_ref      = sol_range_ref.begin();
+        while ( it_sol_ref->time < t_span.back() )
+        {
+            ++it_sol_ref;
+        }
+
+        INFO( "composition ", composition.id );
+        CHECK( n_steps < 1000 );
+        CHECK( it_sol.meth.time_steps[0] > 0. );
+        CHECK( it_sol->time == doctest::Approx( it_sol_ref->time ) );
+        CHECK( it_sol->state == doctest::Approx( it_sol_ref->state ).epsilon( 1e-5 ) );
+    };
+
+    check_composition( ponio::splitting::composition::yoshida_4() );
+    check_composition( ponio::splitting::composition::suzuki_4() );
+    check_composition( ponio::splitting::composition::blanes_moan_4() );
+}
+
 TEST_CASE( "number_of_eval::splitting_adaptive_strang" )
 {
     std::size_t manual_counter_1 = 0;
@@ -482,6 +864,11 @@ TEST_CASE( "number_of_eval::splitting_adaptive_strang" )
     auto sol_range       = ponio::make_solver_range( curtiss_hirschfelder, adaptive_strang, y_0, t_span, dt );
     auto it_sol          = sol_range.begin();
 
+    // temporary states are allocated when the method is built, and never reallocated
+    using splitting_t = std::remove_cvref_t<decltype( it_sol.meth )>;
+    CHECK( it_sol.meth.buffers.size() == splitting_t::N_buffers );
+    auto const* buffers_ptr = it_sol.meth.buffers.data();
+
     std::size_t cumulative_counter_1 = 0;
     std::size_t cumulative_counter_2 = 0;
     while ( it_sol->time < t_span.back() )
@@ -495,4 +882,154 @@ TEST_CASE( "number_of_eval::splitting_adaptive_strang" )
 
     CHECK( cumulative_counter_1 == manual_counter_1 );
     CHECK( cumulative_counter_2 == manual_counter_2 );
+    CHECK( it_sol.meth.buffers.data() == buffers_ptr );
+}
+
+TEST_CASE( "number_of_eval::adaptive_strang_shifted_methods" )
+{
+    double const k = 50;
+
+    auto f1 = ponio::make_simple_problem(
+        [&]( double, double y )
+        {
+            return -k * y;
+        } );
+    auto f2 = ponio::make_simple_problem(
+        [&, k]( double t, double )
+        {
+            return k * std::cos( t );
+        } );
+
+    double const y_0 = 2.0;
+
+    ponio::time_span<double> const t_span = { 0., 2. };
+    double const dt                       = 0.05;
+
+    auto curtiss_hirschfelder = ponio::make_problem( f1, f2 );
+
+    auto adaptive_strang = ponio::splitting::make_adaptive_strang_tuple( 5e-3,
+        1e-3,
+        std::make_pair( ponio::runge_kutta::rk54_6m().abs_tol( 1e-6 ).rel_tol( 1e-6 ), 1e-3 ),
+        std::make_pair( ponio::runge_kutta::rk_33(), 0.25 * dt ) );
+    auto sol_range = ponio::make_solver_range( curtiss_hirschfelder, adaptive_strang, y_0, t_span, dt );
+    auto it_sol    = sol_range.begin();
+
+    // a sub-method configured after construction is used for both reference and shifted solutions
+    std::get<0>( it_sol.meth.methods ).info().absolute_tolerance = 1e-9;
+    std::get<0>( it_sol.meth.methods ).info().relative_tolerance = 1e-8;
+    ++it_sol;
+
+    CHECK( std::get<0>( it_sol.meth.methods_shift ).info().absolute_tolerance == 1e-9 );
+    CHECK( std::get<0>( it_sol.meth.methods_shift ).info().relative_tolerance == 1e-8 );
+}
+
+TEST_CASE( "number_of_eval::adaptive_strang_error_budget" )
+{
+    double const k = 50;
+
+    auto f1 = ponio::make_simple_problem(
+        [&]( double, double y )
+        {
+            return -k * y;
+        } );
+    auto f2 = ponio::make_simple_problem(
+        [&, k]( double t, double )
+        {
+            return k * std::cos( t );
+        } );
+
+    double const y_0 = 2.0;
+
+    ponio::time_span<double> const t_span = { 0., 2. };
+    double const dt                       = 0.05;
+
+    auto curtiss_hirschfelder = ponio::make_problem( f1, f2 );
+
+    auto adaptive_strang = ponio::splitting::make_adaptive_strang_tuple( 5e-3,
+        1e-3,
+        std::make_pair( ponio::runge_kutta::rk54_6m().abs_tol( 1e-4 ).rel_tol( 1e-4 ), 1e-3 ),
+        std::make_pair( ponio::runge_kutta::rk_33(), 0.25 * dt ) );
+    auto sol_range = ponio::make_solver_range( curtiss_hirschfelder, adaptive_strang, y_0, t_span, dt );
+    auto it_sol    = sol_range.begin();
+
+    // budget is shared by embedded methods of both reference and shifted solutions
+    CHECK( std::get<0>( it_sol.meth.methods ).info().absolute_tolerance == doctest::Approx( 1e-4 / 3. ) );
+
+    it_sol.meth.share_error_budget( 1e-6, 1e-6 );
+    CHECK( std::get<0>( it_sol.meth.methods ).info().absolute_tolerance == doctest::Approx( 1e-6 / 3. ) );
+    CHECK( std::get<0>( it_sol.meth.methods_shift ).info().absolute_tolerance == doctest::Approx( 1e-6 / 3. ) );
+    CHECK( std::get<0>( it_sol.meth.methods_shift ).info().relative_tolerance == doctest::Approx( 1e-6 / 3. ) );
+
+    while ( it_sol->time < t_span.back() )
+    {
+        ++it_sol;
+        CHECK( std::get<0>( it_sol.meth.methods_shift ).info().absolute_tolerance == doctest::Approx( 1e-6 / 3. ) );
+    }
+
+    // splitting error is controlled by adaptive Strang tolerance
+    CHECK( it_sol->state == doctest::Approx( 2500. / 2501. * std::cos( 2. ) + 50. / 2501. * std::sin( 2. ) ).epsilon( 1e-2 ) );
+}
+
+TEST_CASE( "number_of_eval::parallel_adaptive_strang" )
+{
+    std::atomic<std::size_t> manual_counter_1 = 0;
+    std::atomic<std::size_t> manual_counter_2 = 0;
+
+    double const k = 50;
+    auto f1        = ponio::make_simple_problem(
+        [&]( double, double y )
+        {
+            ++manual_counter_1;
+            return -k * y;
+        } );
+    auto f2 = ponio::make_simple_problem(
+        [&, k]( double t, double )
+        {
+            ++manual_counter_2;
+            return k * std::cos( t );
+        } );
+
+    double const y_0 = 2.0;
+
+    ponio::time_span<double> const t_span = { 0., 2. };
+    double const dt                       = 0.05;
+
+    auto curtiss_hirschfelder = ponio::make_problem( f1, f2 );
+
+    double const delta   = 5e-3;
+    double const tol     = 1e-3;
+    auto adaptive_strang = ponio::splitting::make_adaptive_strang_tuple( delta,
+        tol,
+        std::make_pair( ponio::runge_kutta::rk_33(), 0.125 * dt ),
+        std::make_pair( ponio::runge_kutta::rk_33(), 0.25 * dt ) );
+    auto parallel_adaptive_strang = ponio::splitting::make_parallel_adaptive_strang_tuple( delta,
+        tol,
+        std::make_pair( ponio::runge_kutta::rk_33(), 0.125 * dt ),
+        std::make_pair( ponio::runge_kutta::rk_33(), 0.25 * dt ) );
+
+    auto sol_range          = ponio::make_solver_range( curtiss_hirschfelder, adaptive_strang, y_0, t_span, dt );
+    auto parallel_sol_range = ponio::make_solver_range( curtiss_hirschfelder, parallel_adaptive_strang, y_0, t_span, dt );
+    auto it_sol             = sol_range.begin();
+    auto it_parallel_sol    = parallel_sol_range.begin();
+
+    // shifted sweep runs on a thread created once
+    auto const* workers_ptr = it_parallel_sol.meth.workers.get();
+    REQUIRE( workers_ptr != nullptr );
+
+    while ( it_sol->time < t_span.back() )
+    {
+        ++it_sol;
+
+        manual_counter_1 = 0;
+        manual_counter_2 = 0;
+        ++it_parallel_sol;
+
+        CHECK( std::get<0>( it_parallel_sol.info().number_of_eval ) == manual_counter_1 );
+        CHECK( std::get<1>( it_parallel_sol.info().number_of_eval ) == manual_counter_2 );
+
+        // both sweeps are independent, so concurrent computation gives same solution than sequential one
+        CHECK( it_parallel_sol->time == it_sol->time );
+        CHECK( it_parallel_sol->state == it_sol->state );
+        CHECK( it_parallel_sol.meth.workers.get() == workers_ptr );
+    }
 }
@@ -6,9 +6,12 @@
 #include <doctest/doctest.h>
 
 #include "detail.hxx"         // IWYU pragma: keep
+#include "error_norm.hxx"     // IWYU pragma: keep
 #include "expressions.hxx"    // IWYU pragma: keep
 #include "iteration_info.hxx" // IWYU pragma: keep
+#include "method.hxx"         // IWYU pragma: keep
 #include "observer.hxx"       // IWYU pragma: keep
+#include "problem.hxx"        // IWYU pragma: keep
 #include "test_order.hxx"     // IWYU pragma: keep
 
 #ifdef BUILD_SAMURAI_DEMOS
@@ -0,0 +1,127 @@
+// Copyright 2022 PONIO TEAM. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <valarray>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include <ponio/detail.hpp>
+#include <ponio/method.hpp>
+#include <ponio/runge_kutta.hpp>
+
+TEST_CASE( "method::storage_size" )
+{
+    using state_t = std::valarray<double>;
+
+    SUBCASE( "static number of stages" )
+    {
+        // 4 stages, the solution and `ui`
+        CHECK( ponio::storage_size_v<decltype( ponio::runge_kutta::rk_44() ), state_t> == 6 );
+    }
+
+    SUBCASE( "stabilized methods" )
+    {
+        // storage doesn't depend on number of stages
+        CHECK( ponio::storage_size_v<decltype( ponio::runge_kutta::explicit_rkc2<5>() ), state_t> == 4 );
+        CHECK( ponio::storage_size_v<decltype( ponio::runge_kutta::explicit_rkc2<40>() ), state_t> == 4 );
+        CHECK( ponio::storage_size_v<decltype( ponio::runge_kutta::explicit_rkl1<40>() ), state_t> == 3 );
+        CHECK( ponio::storage_size_v<decltype( ponio::runge_kutta::explicit_rkl2<40>() ), state_t> == 4 );
+        CHECK( ponio::storage_size_v<decltype( ponio::runge_kutta::rock::rock2<false>() ), state_t> == 4 );
+        CHECK( ponio::storage_size_v<decltype( ponio::runge_kutta::rock::rock4<false>() ), state_t> == 4 );
+        CHECK( ponio::storage_size_v<decltype( ponio::runge_kutta::rock::rock4<true>() ), state_t> == 5 );
+    }
+}
+
+TEST_CASE( "method::fused_error_estimate" )
+{
+    using state_t = std::vector<double>;
+    using rk_t    = decltype( ponio::runge_kutta::rk54_6m() );
+
+    static_assert( rk_t::fuses_error_estimate<state_t> );
+
+    auto f = []( double, state_t const& u, state_t& du )
+    {
+        for ( std::size_t i = 0; i < u.size(); ++i )
+        {
+            du[i] = -static_cast<double>( i + 1 ) * u[i] + std::cos( u[i] );
+        }
+    };
+
+    state_t un( 37 ), unp1( 37 );
+    for ( std::size_t i = 0; i < un.size(); ++i )
+    {
+        un[i] = std::sin( static_cast<double>( i ) );
+    }
+
+    auto meth = ponio::make_method<double>( ponio::runge_kutta::rk54_6m(), un );
+
+    double tn = 0.;
+    double dt = 1e-3;
+    meth( f, tn, un, dt, unp1 );
+
+    REQUIRE( meth.info().success );
+    // solution is swapped with `unp1` and embedded solution is still in last stage
+    CHECK( meth.info().error
+           == doctest::Approx( ponio::detail::error_estimate( un,
+               unp1,
+               meth.kis[rk_t::N_stages + 1],
+               meth.info().absolute_tolerance,
+               meth.info().relative_tolerance ) ) );
+}
+
+TEST_CASE( "method::mixed_precision_stages" )
+{
+    using state_t = std::vector<double>;
+
+    auto f = []( double, state_t const& u, auto& du )
+    {
+        for ( std::size_t i = 0; i < u.size(); ++i )
+        {
+            using stage_value_t = typename std::remove_cvref_t<decltype( du )>::value_type;
+            du[i]               = static_cast<stage_value_t>( -static_cast<double>( i + 1 ) * u[i] + std::cos( u[i] ) );
+        }
+    };
+
+    state_t un( 37 );
+    for ( std::size_t i = 0; i < un.size(); ++i )
+    {
+        un[i] = std::sin( static_cast<double>( i ) );
+    }
+
+    auto rk      = ponio::runge_kutta::rk54_6m();
+    auto rk_f32  = ponio::runge_kutta::rk54_6m().stage_storage<std::vector<float>>();
+    auto meth    = ponio::make_method<double>( rk, un );
+    auto meth_32 = ponio::make_method<double>( rk_f32, un );
+
+    // stages are stored in single precision, solutions in double precision
+    static constexpr std::size_t N_stages = decltype( rk )::N_stages;
+    static_assert( std::same_as<std::remove_cvref_t<decltype( ponio::detail::stage_at<0>( meth_32.stages() ) )>, std::vector<float>> );
+    static_assert( std::same_as<std::remove_cvref_t<decltype( ponio::detail::stage_at<N_stages>( meth_32.stages() ) )>, state_t> );
+
+    state_t un_32 = un;
+    state_t unp1( un.size() ), unp1_32( un.size() );
+
+    double tn = 0., tn_32 = 0.;
+    double dt = 1e-2, dt_32 = 1e-2;
+    meth( f, tn, un, dt, unp1 );
+    meth_32( f, tn_32, un_32, dt_32, unp1_32 );
+
+    REQUIRE( meth.info().success );
+    REQUIRE( meth_32.info().success );
+    CHECK( tn_32 == tn );
+
+    // stages (of magnitude up to 40) are rounded in single precision, so solution differs by about 1e-2*40*6e-8
+    for ( std::size_t i = 0; i < un.size(); ++i )
+    {
+        CHECK( std::abs( unp1_32[i] - unp1[i] ) < 1e-7 );
+    }
+    CHECK( meth_32.info().error == doctest::Approx( meth.info().error ).epsilon( 1e-2 ) );
+}
@@ -3,9 +3,18 @@
 // license that can be found in the LICENSE file.
 
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
+#include <ios>
+#include <string>
+#include <vector>
 #include <ponio/observer.hpp>
+#include <ponio/runge_kutta.hpp>
+#include <ponio/solver.hpp>
 
 TEST_CASE( "ponio::observer::file_observer_currentpath" )
 {
@@ -84,3 +93,123 @@ TEST_CASE( "ponio::observer::file_observer_newdir" )
 
     std::filesystem::remove_all( test_path.parent_path() );
 }
+
+namespace binary_observer_test
+{
+    template <typename T>
+    void
+    read_values( std::ifstream& input, T* values, std::size_t count = 1 )
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        input.read( reinterpret_cast<char*>( values ), static_cast<std::streamsize>( count * sizeof( T ) ) );
+    }
+
+    // content of a file written by `binary_observer<double>`, with the last component of state of each record
+    struct content
+    {
+        std::string magic;
+        std::array<char, 4> dtype;
+        std::uint32_t version;
+        std::vector<std::uint64_t> n_records;
+        std::vector<double> tn;
+        std::vector<double> dt;
+        std::vector<double> u;
+
+        explicit content( std::filesystem::path const& path )
+        {
+            std::ifstream input( path, std::ios::binary );
+
+            std::array<char, 8> magic_;
+            input.read( magic_.data(), static_cast<std::streamsize>( magic_.size() ) );
+            magic = std::string( magic_.data(), magic_.size() );
+            input.read( dtype.data(), static_cast<std::streamsize>( dtype.size() ) );
+            read_values( input, &version );
+
+            std::uint64_t n, m;
+            while ( input.peek() != std::ifstream::traits_type::eof() )
+            {
+                read_values( input, &n );
+                read_values( input, &m );
+                n_records.push_back( n );
+
+                std::vector<double> columns( n * m );
+                read_values( input, columns.data(), columns.size() );
+
+                auto const n_ = static_cast<std::ptrdiff_t>( n );
+                auto const m_ = static_cast<std::ptrdiff_t>( m );
+                tn.insert( tn.end(), columns.begin(), columns.begin() + n_ );
+                dt.insert( dt.end(), columns.begin() + n_, columns.begin() + 2 * n_ );
+                u.insert( u.end(), columns.begin() + ( m_ - 1 ) * n_, columns.end() );
+            }
+        }
+    };
+} // namespace binary_observer_test
+
+TEST_CASE( "ponio::observer::binary_observer" )
+{
+    std::filesystem::path test_path = "my_binary_dir/test.bin";
+
+    { // create an observer only in this scope, with buffers of 2 records (t, dt and 3 components)
+        ponio::observer::binary_observer<double> obs( test_path, 10 * sizeof( double ) );
+        for ( int i = 0; i < 5; ++i )
+        {
+            double const tn = 0.1 * i;
+            obs( tn, std::vector<double>{ tn, 2. * tn, 3. * tn }, 0.1 );
+        }
+        // size of state changes: a new block starts
+        obs( 0.5, 42., 0.1 );
+    }
+
+    binary_observer_test::content const file( test_path );
+
+    CHECK( file.magic == "PONIOCOL" );
+    CHECK( file.dtype[1] == 'f' );
+    CHECK( file.dtype[2] == '8' );
+    CHECK( file.version == ponio::observer::binary_observer<double>::version );
+
+    CHECK( file.n_records == std::vector<std::uint64_t>{ 2, 2, 1, 1 } );
+    REQUIRE( file.tn.size() == 6 );
+    REQUIRE( file.u.size() == 6 );
+    for ( std::size_t i = 0; i < 5; ++i )
+    {
+        CHECK( file.tn[i] == 0.1 * static_cast<double>( i ) );
+        CHECK( file.dt[i] == 0.1 );
+        // third component of state
+        CHECK( file.u[i] == 3. * file.tn[i] );
+    }
+    CHECK( file.tn[5] == 0.5 );
+    CHECK( file.u[5] == 42. );
+
+    std::filesystem::remove_all( test_path.parent_path() );
+}
+
+TEST_CASE( "ponio::observer::binary_observer_solve" )
+{
+    std::filesystem::path test_path = "my_binary_solve_dir/test.bin";
+
+    auto pb = []( double, double u, double& du )
+    {
+        du = -u;
+    };
+
+    double const dt = 0.01;
+    double u_end    = 0.;
+
+    { // observer given to solver, with buffers smaller than the whole solution
+        ponio::observer::binary_observer<double> obs( test_path, 64 * sizeof( double ) );
+        u_end = ponio::solve( pb, ponio::runge_kutta::rk_33(), 1., { 0., 1. }, dt, obs );
+    }
+
+    binary_observer_test::content const file( test_path );
+
+    REQUIRE( file.tn.size() == 101 );
+    CHECK( file.n_records.size() > 1 );
+    CHECK( file.tn.front() == 0. );
+    CHECK( file.tn.back() == doctest::Approx( 1. ) );
+    CHECK( file.u.front() == 1. );
+    CHECK( file.u.back() == u_end );
+    CHECK( u_end == doctest::Approx( std::exp( -1. ) ) );
+    CHECK( std::ranges::is_sorted( file.tn ) );
+
+    std::filesystem::remove_all( test_path.parent_path() );
+}
@@ -0,0 +1,268 @@
+// Copyright 2022 PONIO TEAM. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <thread>
+#include <valarray>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include <ponio/problem.hpp>
+
+TEST_CASE( "problem::sum_of_components" )
+{
+    using state_t = std::valarray<double>;
+
+    auto f1 = []( double, state_t const& y, state_t& dy )
+    {
+        dy = -y;
+    };
+    auto f2 = []( double t, state_t const& y, state_t& dy )
+    {
+        dy = t * y * y;
+    };
+    auto f3 = []( double, state_t const& y, state_t& dy )
+    {
+        dy = 2. * y + 1.;
+    };
+
+    state_t const y = { 0.5, 1., 2. };
+    double const t  = 0.3;
+
+    state_t expected = -y + t * y * y + 2. * y + 1.;
+
+    SUBCASE( "sequential evaluation" )
+    {
+        auto pb    = ponio::make_problem( f1, f2, f3 );
+        state_t dy = y;
+        pb( t, y, dy );
+
+        for ( std::size_t i = 0; i < y.size(); ++i )
+        {
+            CHECK( dy[i] == doctest::Approx( expected[i] ) );
+        }
+
+        // buffers are allocated once and reused
+        auto const* ptr_buffer = &( *pb._components_buffers( dy ) )[0][0];
+        pb( t, y, dy );
+        CHECK( &( *pb._components_buffers( dy ) )[0][0] == ptr_buffer );
+    }
+
+    SUBCASE( "parallel evaluation" )
+    {
+        auto pb = ponio::make_parallel_problem( f1, f2, f3 );
+        REQUIRE( pb.workers != nullptr );
+        CHECK( pb.workers->size() == 2 );
+
+        // same workers are used for each evaluation
+        state_t dy = y;
+        for ( int n = 0; n < 10; ++n )
+        {
+            pb( t, y, dy );
+        }
+
+        for ( std::size_t i = 0; i < y.size(); ++i )
+        {
+            CHECK( dy[i] == doctest::Approx( expected[i] ) );
+        }
+    }
+
+    SUBCASE( "concurrent evaluations" )
+    {
+        // evaluations of independent stages from several threads, each call uses its own buffers
+        auto pb = ponio::make_parallel_problem( f1, f2, f3 );
+        pb.allocate_buffers( y, 4 );
+
+        std::array<state_t, 4> ys;
+        std::array<state_t, 4> dys;
+        for ( std::size_t k = 0; k < ys.size(); ++k )
+        {
+            ys[k]  = static_cast<double>( k + 1 ) * y;
+            dys[k] = y;
+        }
+
+        std::vector<std::thread> threads;
+        for ( std::size_t k = 0; k < ys.size(); ++k )
+        {
+            threads.emplace_back(
+                [&, k]()
+                {
+                    for ( int n = 0; n < 100; ++n )
+                    {
+                        pb( t, ys[k], dys[k] );
+                    }
+                } );
+        }
+        for ( auto& thread : threads )
+        {
+            thread.join();
+        }
+
+        for ( std::size_t k = 0; k < ys.size(); ++k )
+        {
+            state_t expected_k = -ys[k] + t * ys[k] * ys[k] + 2. * ys[k] + 1.;
+            for ( std::size_t i = 0; i < y.size(); ++i )
+            {
+                CHECK( dys[k][i] == doctest::Approx( expected_k[i] ) );
+            }
+        }
+    }
+}
+
+TEST_CASE( "problem::imex_problem" )
+{
+    using state_t = std::valarray<double>;
+
+    auto f = []( double t, state_t const& y, state_t& dy )
+    {
+        dy = t * y * y;
+    };
+    auto g = []( double, state_t const& y, state_t& dy )
+    {
+        dy = -2. * y;
+    };
+    auto dg = []( double, state_t const& )
+    {
+        return -2.;
+    };
+
+    auto pb = ponio::make_imex_jacobian_problem( f, g, dg );
+
+    state_t const y = { 0.5, 1., 2. };
+    double const t  = 0.3;
+
+    state_t expected = t * y * y - 2. * y;
+
+    state_t dy = y;
+    pb( t, y, dy );
+
+    for ( std::size_t i = 0; i < y.size(); ++i )
+    {
+        CHECK( dy[i] == doctest::Approx( expected[i] ) );
+    }
+
+    // buffer of implicit part is allocated once and reused
+    auto const* ptr_buffer = &( *pb._implicit_buffer( dy ) )[0];
+    pb( t, y, dy );
+    CHECK( &( *pb._implicit_buffer( dy ) )[0] == ptr_buffer );
+}
+
+TEST_CASE( "problem::simple_problem_returned_states" )
+{
+    using state_t = std::vector<double>;
+
+    state_t const y = { 0.5, 1., 2. };
+    double const t  = 0.3;
+
+    SUBCASE( "return a new state" )
+    {
+        auto pb = ponio::make_simple_problem(
+            []( double tn, state_t const& yn ) -> state_t
+            {
+                return { tn * yn[0], tn * yn[1], tn * yn[2] };
+            } );
+
+        state_t dy( 3 );
+        pb( t, y, dy );
+        pb( t, y, dy );
+
+        CHECK( pb.number_of_returned_states == 2 );
+        for ( std::size_t i = 0; i < y.size(); ++i )
+        {
+            CHECK( dy[i] == doctest::Approx( t * y[i] ) );
+        }
+    }
+
+    SUBCASE( "return a ponio expression" )
+    {
+        auto pb = ponio::make_simple_problem(
+            []( double tn, state_t const& yn )
+            {
+                return ponio::expression::make_scalar( tn ) * ponio::expression::make_state( yn );
+            } );
+
+        state_t dy( 3 );
+        auto const* ptr_dy = dy.data();
+        pb( t, y, dy );
+
+        CHECK( pb.number_of_returned_states == 0 );
+        CHECK( dy.data() == ptr_dy );
+        for ( std::size_t i = 0; i < y.size(); ++i )
+        {
+            CHECK( dy[i] == doctest::Approx( t * y[i] ) );
+        }
+    }
+}
+
+struct batch_functor
+{
+    std::size_t number_of_calls       = 0;
+    std::size_t number_of_batch_calls = 0;
+
+    void
+    operator()( double t, std::valarray<double> const& y, std::valarray<double>& dy )
+    {
+        ++number_of_calls;
+        dy = t * y;
+    }
+
+    template <std::size_t N>
+    void
+    f_batch( std::array<double, N> const& t_list,
+        std::array<std::valarray<double>*, N> const& u_list,
+        std::array<std::valarray<double>*, N> const& du_list )
+    {
+        ++number_of_batch_calls;
+        for ( std::size_t i = 0; i < N; ++i )
+        {
+            *du_list[i] = t_list[i] * ( *u_list[i] );
+        }
+    }
+};
+
+TEST_CASE( "problem::evaluate_batch" )
+{
+    using state_t = std::valarray<double>;
+
+    state_t u1 = { 1., 2. };
+    state_t u2 = { 3., 4. };
+    state_t du1( 2 );
+    state_t du2( 2 );
+
+    std::array<double, 2> const t_list    = { 0.5, 2. };
+    std::array<state_t*, 2> const u_list  = { &u1, &u2 };
+    std::array<state_t*, 2> const du_list = { &du1, &du2 };
+
+    SUBCASE( "problem with f_batch" )
+    {
+        auto pb = ponio::make_simple_problem( batch_functor{} );
+        static_assert( ponio::has_f_batch<decltype( pb ), double, state_t, 2> );
+
+        ponio::evaluate_batch( pb, t_list, u_list, du_list );
+
+        CHECK( pb.f.number_of_batch_calls == 1 );
+        CHECK( pb.f.number_of_calls == 0 );
+        CHECK( du1[1] == doctest::Approx( 1. ) );
+        CHECK( du2[1] == doctest::Approx( 8. ) );
+    }
+
+    SUBCASE( "fallback on one call per state" )
+    {
+        auto pb = ponio::make_simple_problem(
+            []( double t, state_t const& y, state_t& dy )
+            {
+                dy = t * y;
+            } );
+        static_assert( !ponio::has_f_batch<decltype( pb ), double, state_t, 2> );
+
+        ponio::evaluate_batch( pb, t_list, u_list, du_list );
+
+        CHECK( du1[1] == doctest::Approx( 1. ) );
+        CHECK( du2[1] == doctest::Approx( 8. ) );
+    }
+}
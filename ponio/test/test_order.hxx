@@ -254,6 +254,7 @@ TEST_CASE( "order::chebychev_runge_kutta" )
     // clang-format off
     using rkc_methods = std::tuple<
         decltype( ponio::runge_kutta::chebyshev::explicit_rkc2<10>() ),
+        decltype( ponio::runge_kutta::chebyshev::explicit_rkc2<40>() ),
         decltype( ponio::runge_kutta::rock::rock2<false>() ),
         decltype( ponio::runge_kutta::rock::rock4<false>() )
     >;
@@ -275,6 +276,19 @@ TEST_CASE( "order::legendre_runge_kutta" )
     test_order<class_method::explicit_method>::on<rkl_methods>();
 }
 
+TEST_CASE( "order::parallel_iterated_runge_kutta" )
+{
+    // clang-format off
+    using pirk_methods = std::tuple<
+        ponio::runge_kutta::pirk_gauss_4,
+        ponio::runge_kutta::pirk_radau_5,
+        ponio::runge_kutta::parallel_iterated_runge_kutta::parallel_iterated_runge_kutta<ponio::runge_kutta::parallel_iterated_runge_kutta::butcher_radau_iia_3<double>, 2>
+    >;
+    // clang-format on
+
+    test_order<class_method::explicit_method>::on<pirk_methods>();
+}
+
 TEST_CASE( "order::pirock" )
 {
     // clang-format off
@@ -421,6 +435,102 @@ TEST_CASE( "order::splitting[even]" )
     }
 }
 
+TEST_CASE( "order::splitting[composition]" )
+{
+    auto check_composition_order = []<typename scheme_t>( scheme_t )
+    {
+        auto composition_splitting = ponio::splitting::make_composition_tuple<scheme_t>(
+            std::make_pair( ponio::runge_kutta::rk_44(), 1e-3 ),
+            std::make_pair( ponio::runge_kutta::rk_44(), 1e-3 ) );
+
+        double computed_order;
+        double computed_cst;
+
+        // use std::tie because of a bug in clang++-15
+        std::tie( computed_order, computed_cst ) = splitting_method::finite_time_check_order( composition_splitting );
+
+        INFO( "test order of ", composition_splitting.id );
+        INFO( "theoretical order: ", composition_splitting.order );
+        INFO( "computed order   : ", computed_order );
+        INFO( "computed error constant: ", computed_cst );
+
+        if ( computed_cst > -8. ) // error is to close than computer error
+        {
+            CHECK( computed_order >= doctest::Approx( composition_splitting.order ).epsilon( 0.125 ) );
+            WARN( computed_order == doctest::Approx( composition_splitting.order ).epsilon( 0.125 ) );
+        }
+        else
+        {
+            WARN( computed_order == doctest::Approx( composition_splitting.order ).epsilon( 2. ) );
+        }
+    };
+
+    check_composition_order( ponio::splitting::composition::mclachlan_2() );
+    check_composition_order( ponio::splitting::composition::yoshida_4() );
+    check_composition_order( ponio::splitting::composition::suzuki_4() );
+    check_composition_order( ponio::splitting::composition::blanes_moan_4() );
+}
+
+TEST_CASE( "order::mri_gark" )
+{
+    double const k = 50.;
+
+    // fast and stiff relaxation toward cos(t), slow non-linear coupling
+    auto f_fast = ponio::make_simple_problem(
+        [k]( double t, double y )
+        {
+            return -k * ( y - std::cos( t ) );
+        } );
+    auto f_slow = ponio::make_simple_problem(
+        []( double t, double y )
+        {
+            return -std::sin( t ) + ( y - std::cos( t ) ) + 0.5 * std::sin( 3. * y );
+        } );
+    auto pb = ponio::make_problem( f_fast, f_slow );
+
+    double const y_0                      = 0.5;
+    ponio::time_span<double> const t_span = { 0., 1. };
+
+    double const y_ref = ponio::solve( pb, ponio::runge_kutta::rk_44(), y_0, t_span, 1e-5, []( double, double, double ) {} );
+
+    auto check_mri_order = [&]<typename tableau_t>( tableau_t )
+    {
+        std::vector<double> log_errors;
+        std::vector<double> log_dts;
+
+        for ( double dt : { 0.05, 0.025, 0.0125, 0.00625 } )
+        {
+            auto mri   = ponio::splitting::make_mri_gark_tuple<tableau_t>( std::make_pair( ponio::runge_kutta::rk_44(), 1e-4 ) );
+            auto y_end = ponio::solve( pb, mri, y_0, t_span, dt, []( double, double, double ) {} );
+
+            log_errors.push_back( std::log10( std::abs( y_end - y_ref ) ) );
+            log_dts.push_back( std::log10( dt ) );
+        }
+
+        auto [computed_order, computed_cst] = mayor_method( log_dts, log_errors );
+
+        INFO( "test order of ", tableau_t::id );
+        INFO( "theoretical order: ", tableau_t::order );
+        INFO( "computed order   : ", computed_order );
+        CHECK( computed_order >= doctest::Approx( tableau_t::order ).epsilon( 0.125 ) );
+
+        // one evaluation of slow sub-problem per stage
+        auto mri      = ponio::splitting::make_mri_gark_tuple<tableau_t>( std::make_pair( ponio::runge_kutta::rk_44(), 1e-4 ) );
+        auto mri_meth = ponio::make_method<double>( mri, y_0 );
+        double t      = 0.;
+        double dt     = 0.05;
+        double y      = y_0;
+        double y_next = y_0;
+        mri_meth( pb, t, y, dt, y_next );
+        CHECK( mri_meth.number_of_slow_eval == tableau_t::N_stages );
+        CHECK( t == doctest::Approx( 0.05 ) );
+    };
+
+    check_mri_order( ponio::splitting::mri::mri_gark_erk22a() );
+    check_mri_order( ponio::splitting::mri::mri_gark_erk22b() );
+    check_mri_order( ponio::splitting::mri::mri_gark_erk33a() );
+}
+
 TEST_CASE( "order::splitting::_split_solve" )
 {
     // test the implementation of `ponio::splitting::detail::_split_solve` function